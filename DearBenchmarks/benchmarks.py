@@ -0,0 +1,447 @@
+from dearpygui.core import *
+from dearpygui.simple import *
+import json
+import math
+import os
+import platform
+import statistics
+import sys
+import tempfile
+import time
+
+########################################################################################################################
+# DearPyGui Benchmarks
+#
+#   Reproducible hot path scenarios run headlessly (no window or GPU). Each
+#   scenario is a generator driven from the render callback, every yield
+#   advances one frame so queued item adds/deletes and rendering are timed
+#   the way an application sees them. A step is timed from its start until
+#   the next frame begins.
+#
+#   usage: dpg_benchmarks [--out file.json] [--repeats N] [--filter text]
+#          python benchmarks.py [...]           (installed dearpygui)
+########################################################################################################################
+
+def parse_args(argv):
+    options = {"out": "dpg_benchmarks.json", "repeats": 3, "filter": ""}
+    i = 0
+    while i < len(argv):
+        if argv[i] in ("--out", "--repeats", "--filter") and i + 1 < len(argv):
+            key = argv[i][2:]
+            options[key] = int(argv[i + 1]) if key == "repeats" else argv[i + 1]
+            i += 1
+        i += 1
+    return options
+
+options = parse_args(sys.argv[1:])
+samples = {}  # (scenario, metric) -> [ms]
+
+def record(scenario, metric, seconds):
+    samples.setdefault((scenario, metric), []).append(seconds * 1000.0)
+
+class Frame:
+    """time.perf_counter() at the start of the frame that resumed the scenario."""
+    now = 0.0
+
+def step(scenario, metric, start):
+    record(scenario, metric, Frame.now - start)
+
+def render_frames(scenario, count):
+    start = Frame.now
+    for _ in range(count):
+        yield
+    record(scenario, "frame", (Frame.now - start) / count)
+
+########################################################################################################################
+# Scenarios
+########################################################################################################################
+
+def widget_tree(count):
+
+    name = f"widget_tree_{count // 1000}k"
+
+    def scenario():
+        start = time.perf_counter()
+        add_window("bench", width=800, height=600)
+        end()
+        groups = max(1, count // 100)
+        for g in range(groups):
+            add_group(f"g{g}", parent="bench")
+            end()
+            for i in range(100):
+                add_button(f"b{g}_{i}", parent=f"g{g}")
+        yield
+        step(name, "create", start)
+
+        yield from render_frames(name, 10)
+
+        start = time.perf_counter()
+        for i in range(0, count, max(1, count // 1000)):
+            does_item_exist(f"b{i // 100}_{i % 100}")
+            get_value(f"b{i // 100}_{i % 100}")
+        record(name, "lookup_1k", time.perf_counter() - start)
+
+        start = time.perf_counter()
+        delete_item("bench")
+        yield
+        step(name, "delete", start)
+
+    return name, scenario
+
+def item_tree_churn(count, windows=20):
+
+    name = f"item_tree_churn_{count // 1000}k"
+
+    def build():
+        per_window = count // windows
+        for w in range(windows):
+            add_window(f"churn{w}", width=400, height=300)
+            end()
+            for g in range(per_window // 50):
+                add_group(f"churn{w}_{g}", parent=f"churn{w}")
+                end()
+                for i in range(49):
+                    add_text(f"churn{w}_{g}_{i}", parent=f"churn{w}_{g}")
+
+    def teardown():
+        for w in range(windows):
+            delete_item(f"churn{w}")
+
+    def scenario():
+        # the second build reuses the slots freed by the first teardown
+        for metric in ("build", "rebuild"):
+            start = time.perf_counter()
+            build()
+            yield
+            step(name, metric, start)
+
+            start = time.perf_counter()
+            teardown()
+            yield
+            step(name, "teardown", start)
+
+    return name, scenario
+
+def bulk_delete(count):
+
+    name = f"bulk_delete_{count // 1000}k"
+
+    def scenario():
+        add_window("bulk", width=600, height=800)
+        end()
+        for g in range(count // 100):
+            add_group(f"bulk{g}", parent="bulk")
+            end()
+            for i in range(100):
+                add_text(f"bulk{g}_{i}", parent=f"bulk{g}")
+        yield
+
+        # every item deleted by name within one frame
+        start = time.perf_counter()
+        for g in range(count // 100):
+            for i in range(100):
+                delete_item(f"bulk{g}_{i}")
+        yield
+        step(name, "delete", start)
+
+        delete_item("bulk")
+        yield
+
+    return name, scenario
+
+def form_batch(count):
+
+    name = f"form_batch_{count // 1000}k"
+
+    def scenario():
+        add_window("form", width=600, height=800)
+        end()
+
+        start = time.perf_counter()
+        for i in range(count):
+            add_input_text(f"field{i}", parent="form", hint="value")
+        yield
+        step(name, "per_item", start)
+
+        delete_item("form", children_only=True)
+        yield
+
+        start = time.perf_counter()
+        add_items([{"type": "input_text", "name": f"field{i}", "hint": "value"} for i in range(count)], parent="form")
+        yield
+        step(name, "add_items", start)
+
+        # runtime adds may target items add_items created in the same frame
+        add_items([{"type": "group", "name": "form_footer"}], parent="form")
+        add_button("form_submit", parent="form_footer")
+        yield
+        if not does_item_exist("form_submit"):
+            raise RuntimeError("add_button could not find the group add_items created")
+
+        delete_item("form")
+        yield
+
+    return name, scenario
+
+def value_storage(count):
+
+    name = f"value_storage_{count // 1000}k"
+
+    def scenario():
+        add_window("bench")
+        end()
+        for i in range(100):
+            add_input_float(f"f{i}", parent="bench")
+        yield
+
+        start = time.perf_counter()
+        for i in range(count):
+            set_value(f"f{i % 100}", float(i))
+        record(name, "set_value", time.perf_counter() - start)
+
+        start = time.perf_counter()
+        for i in range(count):
+            get_value(f"f{i % 100}")
+        record(name, "get_value", time.perf_counter() - start)
+
+        delete_item("bench")
+        yield
+
+    return name, scenario
+
+def plot_series(points):
+
+    name = f"plot_series_{points // 1000000}M"
+
+    def scenario():
+        xs = [float(i) for i in range(points)]
+        ys = [float(i % 1000) for i in range(points)]
+        add_window("bench", width=800, height=600)
+        end()
+        add_plot("plot", parent="bench")
+        yield
+
+        start = time.perf_counter()
+        add_line_series("plot", "series", xs, ys)
+        record(name, "create", time.perf_counter() - start)
+
+        yield from render_frames(name, 10)
+
+        delete_item("bench")
+        yield
+
+    return name, scenario
+
+def area_fill(points):
+
+    name = f"area_fill_{points // 1000}k"
+
+    def scenario():
+        xs = [float(i) for i in range(points)]
+        ys = [float(i % 1000) for i in range(points)]
+        # concave star outline, so the polygon fill is ear clipped
+        star = [[350 + (60 + 60 * (i % 2)) * math.cos(2 * math.pi * i / points),
+                 125 + (60 + 60 * (i % 2)) * math.sin(2 * math.pi * i / points)] for i in range(points)]
+        add_window("bench", width=800, height=600)
+        end()
+        add_plot("plot", parent="bench", height=250)
+        add_drawing("drawing", parent="bench", width=700, height=250)
+        yield
+
+        start = time.perf_counter()
+        add_area_series("plot", "area", xs, ys, [255, 255, 255, 255], [255, 0, 0, 100])
+        draw_polygon("drawing", star, [255, 255, 255, 255], fill=[0, 0, 255, 100])
+        record(name, "create", time.perf_counter() - start)
+
+        # fill triangles are cached while the view doesn't change
+        yield from render_frames(name, 10)
+
+        # every frame moves the view, so the area fill is rebuilt
+        start = Frame.now
+        for i in range(10):
+            set_plot_xlimits("plot", float(i * 100), float(points - i * 100))
+            yield
+        record(name, "pan_frame", (Frame.now - start) / 10)
+
+        delete_item("bench")
+        yield
+
+    return name, scenario
+
+def table(rows):
+
+    name = f"table_{rows // 1000}k_rows"
+
+    def scenario():
+        data = [[str(r), str(r * 2), str(r * 3)] for r in range(rows)]
+        add_window("bench", width=800, height=600)
+        end()
+        add_table("table", ["a", "b", "c"], parent="bench")
+        yield
+
+        start = time.perf_counter()
+        set_table_data("table", data)
+        record(name, "set_table_data", time.perf_counter() - start)
+
+        yield from render_frames(name, 10)
+
+        delete_item("bench")
+        yield
+
+    return name, scenario
+
+def draw_commands(count):
+
+    name = f"draw_commands_{count // 1000}k_tagged"
+
+    def scenario():
+        add_window("bench", width=800, height=600)
+        end()
+        add_drawing("drawing", parent="bench", width=700, height=500)
+        yield
+
+        start = time.perf_counter()
+        for i in range(count):
+            draw_line("drawing", [i % 700, 0], [i % 700, 500], [255, 255, 255, 255], 1, tag=f"line{i}")
+        record(name, "create", time.perf_counter() - start)
+
+        yield from render_frames(name, 10)
+
+        start = time.perf_counter()
+        for i in range(0, count, 10):
+            modify_draw_command("drawing", f"line{i}", p1=[0, 0])
+        record(name, "modify_10pct", time.perf_counter() - start)
+
+        delete_item("bench")
+        yield
+
+    return name, scenario
+
+def async_images(count, size=256):
+
+    name = f"async_images_{count}"
+
+    def write_images(directory):
+        # binary ppm, which stb decodes without any codec work of its own
+        files = []
+        for i in range(count):
+            path = os.path.join(directory, f"image{i}.ppm")
+            with open(path, "wb") as file:
+                file.write(f"P6 {size} {size} 255\n".encode())
+                file.write(bytes((x + i) % 256 for x in range(size * 3)) * size)
+            files.append(path)
+        return files
+
+    def scenario():
+        with tempfile.TemporaryDirectory() as directory:
+            files = write_images(directory)
+            loaded = []
+            set_async_texture_loading(True, callback=lambda sender, data: loaded.append(sender))
+            add_window("bench", width=800, height=600)
+            end()
+            yield
+
+            # worst frame while decodes finish and uploads are spread over frames
+            start = time.perf_counter()
+            for i, file in enumerate(files):
+                add_image(f"image{i}", file, parent="bench", width=32, height=32)
+            frame_start = start
+            max_frame = 0.0
+            for _ in range(10_000):
+                yield
+                max_frame = max(max_frame, Frame.now - frame_start)
+                frame_start = Frame.now
+                if len(loaded) >= count:
+                    break
+            step(name, "load", start)
+            record(name, "max_frame", max_frame)
+
+            delete_item("bench")
+            set_async_texture_loading(False)
+            yield
+
+    return name, scenario
+
+def idle_frames():
+
+    name = "idle_frames"
+
+    def scenario():
+        yield from render_frames(name, 120)
+
+    return name, scenario
+
+scenarios = [
+    widget_tree(10_000),
+    widget_tree(100_000),
+    item_tree_churn(20_000),
+    form_batch(2_000),
+    bulk_delete(5_000),
+    value_storage(100_000),
+    plot_series(1_000_000),
+    area_fill(10_000),
+    table(100_000),
+    draw_commands(10_000),
+    async_images(200),
+    idle_frames(),
+]
+
+########################################################################################################################
+# Driver
+########################################################################################################################
+
+def run_all():
+    for name, scenario in scenarios:
+        if options["filter"] not in name:
+            continue
+        for _ in range(options["repeats"]):
+            yield from scenario()
+
+driver = run_all()
+
+def on_frame(sender, data):
+    Frame.now = time.perf_counter()
+    try:
+        next(driver)
+    except StopIteration:
+        stop_dearpygui()
+
+def write_results():
+
+    # timings measured natively by the dpg_benchmarks host (event bus, ...)
+    native = getattr(sys, "dpg_native_results", [])
+
+    results = list(native)
+    for (scenario, metric), values in samples.items():
+        results.append({
+            "name": scenario,
+            "metric": metric,
+            "unit": "ms",
+            "samples": len(values),
+            "min": min(values),
+            "median": statistics.median(values),
+            "mean": statistics.mean(values),
+            "max": max(values),
+        })
+
+    report = {
+        "dearpygui": get_dearpygui_version(),
+        "python": platform.python_version(),
+        "platform": platform.platform(),
+        "time": time.strftime("%Y-%m-%dT%H:%M:%S"),
+        "repeats": options["repeats"],
+        "results": results,
+    }
+
+    with open(options["out"], "w") as file:
+        json.dump(report, file, indent=2)
+
+    print(f"{'benchmark':<34}{'metric':<16}{'median':>12}{'min':>12}  unit")
+    for result in results:
+        print(f"{result['name']:<34}{result['metric']:<16}{result['median']:>12.3f}{result['min']:>12.3f}  {result['unit']}")
+    print(f"wrote {options['out']}")
+
+set_main_window_size(1280, 800)
+set_render_callback(on_frame)
+start_dearpygui(headless=True)
+write_results()
@@ -0,0 +1,188 @@
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include "mvMarvel.h"
+#include "mvApp.h"
+#include "mvEvents.h"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// dpg_benchmarks
+//
+//     - Hosts benchmarks.py headlessly. Scenarios that can't be reached
+//       from python (event bus) are timed here first and handed to the
+//       script as sys.dpg_native_results, which writes everything as JSON.
+//
+//     - Arguments are passed through to the script (see benchmarks.py).
+//
+//-----------------------------------------------------------------------------
+
+using namespace Marvel;
+
+struct mvBenchmarkResult
+{
+	std::string         name;
+	std::string         metric;
+	std::vector<double> samples; // ms
+};
+
+class mvBenchmarkHandler : public mvEventHandler
+{
+
+public:
+
+	bool onEvent(mvEvent& event) override
+	{
+		m_sum += GetEInt(event, "VALUE");
+		return false;
+	}
+
+	long long m_sum = 0;
+
+};
+
+template<typename F>
+static double TimeMs(F f)
+{
+	auto start = std::chrono::steady_clock::now();
+	f();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 1k events per frame through the live app's subscriptions plus 8 benchmark handlers
+static std::vector<mvBenchmarkResult> RunEventBus(int repeats)
+{
+	constexpr int frames = 60;
+	constexpr int events = 1000;
+
+	mvBenchmarkHandler handlers[8];
+	for (auto& handler : handlers)
+		mvEventBus::Subscribe(&handler, SID("BENCHMARK_EVENT"), SID("BENCHMARK_CATEGORY"));
+
+	mvBenchmarkResult publish = { "event_bus_1k_per_frame", "publish", {} };
+	mvBenchmarkResult endFrame = { "event_bus_1k_per_frame", "publish_end_frame", {} };
+
+	for (int repeat = 0; repeat < repeats; repeat++)
+	{
+		publish.samples.push_back(TimeMs([&]() {
+			for (int frame = 0; frame < frames; frame++)
+				for (int i = 0; i < events; i++)
+					mvEventBus::Publish(SID("BENCHMARK_CATEGORY"), SID("BENCHMARK_EVENT"), { CreateEventArgument("VALUE", i) });
+			}) / frames);
+
+		endFrame.samples.push_back(TimeMs([&]() {
+			for (int frame = 0; frame < frames; frame++)
+			{
+				for (int i = 0; i < events; i++)
+					mvEventBus::PublishEndFrame(SID("BENCHMARK_CATEGORY"), SID("BENCHMARK_EVENT"), { CreateEventArgument("VALUE", i) });
+				mvEvent flush = { SID("END_FRAME"), {}, SID("GLOBAL") };
+				mvEventBus::OnFrame(flush);
+			}
+			}) / frames);
+	}
+
+	for (auto& handler : handlers)
+		mvEventBus::UnSubscribe(&handler);
+
+	return { publish, endFrame };
+}
+
+static PyObject* ToPyResult(const mvBenchmarkResult& result)
+{
+	std::vector<double> sorted = result.samples;
+	std::sort(sorted.begin(), sorted.end());
+
+	double mean = 0.0;
+	for (double sample : sorted)
+		mean += sample;
+	mean /= (double)sorted.size();
+
+	size_t middle = sorted.size() / 2;
+	double median = sorted.size() % 2 ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) / 2.0;
+
+	return Py_BuildValue("{s:s,s:s,s:s,s:n,s:d,s:d,s:d,s:d}",
+		"name", result.name.c_str(),
+		"metric", result.metric.c_str(),
+		"unit", "ms",
+		"samples", (Py_ssize_t)sorted.size(),
+		"min", sorted.front(),
+		"median", median,
+		"mean", mean,
+		"max", sorted.back());
+}
+
+static int GetRepeats(int argc, char* argv[])
+{
+	for (int i = 1; i + 1 < argc; i++)
+	{
+		if (std::string(argv[i]) == "--repeats")
+			return std::max(1, atoi(argv[i + 1]));
+	}
+	return 3;
+}
+
+int main(int argc, char* argv[])
+{
+
+	PyImport_AppendInittab("core", &PyInit_core);
+
+	// set path and start the interpreter
+#if defined(_WIN32)
+	wchar_t* path = Py_DecodeLocale("../../DearBenchmarks/;../../Dependencies/cpython/Lib;../../Dependencies/cpython/PCbuild/amd64;../../DearPyGui/", nullptr);
+#elif defined(__APPLE__)
+	Py_SetPythonHome(L".");
+	wchar_t* path = Py_DecodeLocale("../../Dependencies/cpython/debug/build/lib.macosx-10.15-x86_64-3.8-pydebug/:../../Dependencies/cpython/Lib/:../../DearPyGui:../../DearBenchmarks", nullptr);
+#else
+	wchar_t* path = Py_DecodeLocale("../../Dependencies/cpython/debug/build/lib.linux-x86_64-3.8-pydebug/:../../Dependencies/cpython/Lib/:../../DearPyGui:../../DearBenchmarks", nullptr);
+#endif
+
+	Py_SetPath(path);
+	Py_NoSiteFlag = 1; // this must be set to 1
+	Py_DontWriteBytecodeFlag = 1;
+
+	Py_Initialize();
+	if (!Py_IsInitialized())
+	{
+		printf("Error initializing Python interpreter\n");
+		return 1;
+	}
+
+	std::vector<wchar_t*> wargv;
+	for (int i = 0; i < argc; i++)
+		wargv.push_back(Py_DecodeLocale(argv[i], nullptr));
+	PySys_SetArgvEx(argc, wargv.data(), 0);
+
+	PyObject* mmarvel = PyImport_ImportModule("core");
+
+	// native scenarios run against the app's real subscriptions
+	mvApp::GetApp();
+	int repeats = GetRepeats(argc, argv);
+	PyObject* native = PyList_New(0);
+	for (const auto& result : RunEventBus(repeats))
+	{
+		PyObject* item = ToPyResult(result);
+		PyList_Append(native, item);
+		Py_XDECREF(item);
+	}
+	PySys_SetObject("dpg_native_results", native);
+	Py_XDECREF(native);
+
+	PyObject* pModule = PyImport_ImportModule("benchmarks"); // new reference
+
+	int status = 0;
+	if (PyErr_Occurred() || pModule == nullptr)
+	{
+		PyErr_Print();
+		status = 1;
+	}
+
+	Py_XDECREF(pModule);
+	Py_XDECREF(mmarvel);
+
+	for (wchar_t* arg : wargv)
+		PyMem_RawFree(arg);
+
+	return status;
+}
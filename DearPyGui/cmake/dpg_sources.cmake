@@ -14,13 +14,21 @@ set(MARVEL_SOURCES
 	"$<$<PLATFORM_ID:Linux>:src/platform/Linux/mvUtilities.cpp>"
 	"$<$<PLATFORM_ID:Linux>:src/platform/Linux/mvLinuxWindow.cpp>"
 
+	"src/platform/Headless/mvHeadlessWindow.cpp"
+
 	"src/core/mvEvents.cpp"
 	"src/core/mvApp.cpp"
 	"src/core/mvAppLog.cpp"
 	"src/core/mvInput.cpp"
 	"src/core/mvWindow.cpp"
 	"src/core/mvProfiler.cpp"
+	"src/core/mvCostTracker.cpp"
+	"src/core/mvFrameStats.cpp"
+	"src/core/mvMemory.cpp"
+	"src/core/mvIdentifier.cpp"
 	"src/core/mvThreadPoolManager.cpp"
+	"src/core/mvPolygonFill.cpp"
+	"src/core/mvUtilities.cpp"
 
 	"src/core/Theming/mvAppItemStyleManager.cpp"
 
@@ -65,6 +73,7 @@ set(MARVEL_SOURCES
 	"src/core/AppItems/mvAppItem.cpp"
 	"src/core/AppItems/mvTypeBases.cpp"
 	"src/core/AppItems/mvItemRegistry.cpp"
+	"src/core/AppItems/mvItemPool.cpp"
 
 	"src/core/AppItems/basic/mvMenuItem.cpp"
 	"src/core/AppItems/basic/mvInputText.cpp"
@@ -108,6 +117,7 @@ set(MARVEL_SOURCES
 	
 	"src/core/AppItems/plots/mvPlot.cpp"
 	"src/core/AppItems/plots/mvAreaSeries.cpp"
+	"src/core/AppItems/plots/mvHeatSeries.cpp"
 
 	# implot
 	"vendor/implot/implot.cpp"
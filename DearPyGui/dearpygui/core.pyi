@@ -210,6 +210,10 @@ def add_input_text(name: str, *, default_value: str = '', hint: str = '', multil
 	"""Adds input for text values."""
 	...
 
+def add_items(items: Any, *, parent: str = '', before: str = '') -> bool:
+	"""Adds a list of items, each a dict of an add command's keywords plus its 'type' (i.e. 'input_text'). Items may use earlier items as their parent. The batch is attached to the tree in one step."""
+	...
+
 def add_label_text(name: str, *, default_value: str = '', color: List[float] = (0, 0, 0, -1), tip: str = '', parent: str = '', before: str = '', source: str = '', label: str = '', popup: str = '', show: bool = True) -> None:
 	"""Adds text with a label. Useful for output values."""
 	...
@@ -562,10 +566,22 @@ def get_draw_command(drawing: str, tag: str) -> dict:
 	"""Returns an draw commands information"""
 	...
 
+def get_frame_cost_breakdown(top: int = 0) -> List[dict]:
+	"""Returns the sampled self times (ms) as dicts with name, type, average, max, calls and frames, most expensive first."""
+	...
+
+def get_frame_stats() -> dict:
+	"""Returns frames, dropped frames, target_fps and p50/p95/p99/max/mean times (ms) for frame, pre_render, render, end_frame and present."""
+	...
+
 def get_global_font_scale() -> float:
 	"""Returns the global font scale."""
 	...
 
+def get_headless_draw_stats() -> dict:
+	"""Returns frames rendered and vertices, indices, draw lists and draw commands discarded by the last headless run."""
+	...
+
 def get_item_callback(item: str) -> Callable:
 	"""Returns an item' callback"""
 	...
@@ -630,6 +646,10 @@ def get_managed_column_width(item: str, column: int) -> Float:
 	"""Returns the width of the ith column."""
 	...
 
+def get_memory_stats() -> dict:
+	"""Returns bytes, peak, allocations and total_allocations for imgui, items, value_storage, plot_data, draw_lists, textures, textures_gpu, logger and names (the interned item name table, which also reports its entries), plus the total bytes."""
+	...
+
 def get_mouse_drag_delta() -> (float, float):
 	"""Returns the current mouse drag delta in pixels"""
 	...
@@ -810,7 +830,7 @@ def get_total_time() -> float:
 	"""Returns total time since app started."""
 	...
 
-def get_value(name: str) -> Any:
+def get_value(name: str, *, buffer: bool = False) -> Any:
 	"""Returns an item's value or None if there is none."""
 	...
 
@@ -966,6 +986,10 @@ def render_dearpygui_frame() -> None:
 	"""Renders a DearPyGui frame. Should be called within a user's event loop. Must first call setup_dearpygui outside of event loop."""
 	...
 
+def reset_frame_stats(target_fps: float = 60.0) -> None:
+	"""Clears the frame statistics."""
+	...
+
 def reset_xticks(plot: str) -> None:
 	"""Sets plots x ticks and labels back to automatic"""
 	...
@@ -978,6 +1002,10 @@ def run_async_function(name: Any, data: Any, *, return_handler: Callable = None)
 	"""Runs a function asyncronously."""
 	...
 
+def save_profile(file: str) -> None:
+	"""Saves the last profiler recording as Chrome trace JSON (chrome://tracing or Perfetto)."""
+	...
+
 def select_directory_dialog(callback: Callable = None) -> None:
 	"""Opens a select directory dialog."""
 	...
@@ -994,6 +1022,10 @@ def set_accelerator_callback(callback: Any) -> None:
 	"""Callback similar to keypress but used for accelerator keys."""
 	...
 
+def set_async_texture_loading(value: bool, *, upload_budget: int = 4194304, callback: Callable = None) -> None:
+	"""Decodes image files on the threadpool, showing a placeholder until they are ready."""
+	...
+
 def set_color_map(plot: str, map: int) -> None:
 	"""Sets the color map of the plot's series."""
 	...
@@ -1002,6 +1034,10 @@ def set_exit_callback(callback: Any) -> None:
 	"""Callback to run when exiting main window."""
 	...
 
+def set_frame_cost_sampling(interval: int) -> None:
+	"""Samples the time spent drawing each item and plot series and running each callback. Clears previous samples."""
+	...
+
 def set_global_font_scale(scale: float) -> None:
 	"""Changes the global font scale."""
 	...
@@ -1122,6 +1158,10 @@ def set_plot_ylimits_auto(plot: str) -> None:
 	"""Sets plots y limits to be automatic."""
 	...
 
+def set_power_saving(value: bool, max_idle: float = 1.0) -> None:
+	"""Only renders when input arrives or something changes instead of every frame (Linux)."""
+	...
+
 def set_primary_window(window: str, value: bool) -> None:
 	"""Sets the primary window to fill the viewport."""
 	...
@@ -1274,6 +1314,10 @@ def set_table_selection(table: str, row: int, column: int, value: bool) -> None:
 	"""Sets a table's cell selection value."""
 	...
 
+def set_texture_atlas(value: bool, *, page_size: int = 1024, max_image_size: int = 128) -> None:
+	"""Packs small image files into shared textures so many images can be drawn in a single draw call."""
+	...
+
 def set_theme(theme: str) -> None:
 	"""Set the application's theme to a built-in theme."""
 	...
@@ -1322,14 +1366,26 @@ def show_logger() -> None:
 	"""Shows the logging window. The Default log level is Trace"""
 	...
 
-def start_dearpygui(*, primary_window: str = '') -> None:
+def start_dearpygui(*, primary_window: str = '', headless: bool = False, frames: int = 0) -> None:
 	"""Starts DearPyGui."""
 	...
 
+def start_profiling(events_per_thread: int = 65536) -> None:
+	"""Starts recording profiler scopes on every thread, discarding the previous recording."""
+	...
+
 def stop_dearpygui() -> None:
 	"""Stops DearPyGui."""
 	...
 
+def stop_profiling() -> None:
+	"""Stops recording profiler scopes. The recording is kept until profiling starts again."""
+	...
+
+def update_texture(name: str, data: List[int], x: int, y: int, width: int, height: int, *, format: int = 0) -> None:
+	"""Replaces a region of an existing texture without recreating it."""
+	...
+
 def unindent(*, name: str = 'unindent', offset: float = 0.0, parent: str = '', before: str = '', show: bool = True) -> None:
 	"""Unindents following items."""
 	...
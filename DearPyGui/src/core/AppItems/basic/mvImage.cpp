@@ -11,6 +11,7 @@ namespace Marvel {
 	{
 		m_description.ignoreSizeUpdate = true;
 		mvEventBus::Subscribe(this, mvEVT_DELETE_TEXTURE);
+		mvEventBus::Subscribe(this, mvEVT_TEXTURE_LOADED);
 	}
 
 	mvImage::~mvImage()
@@ -23,10 +24,28 @@ namespace Marvel {
 	{
 		mvEventDispatcher dispatcher(event);
 		dispatcher.dispatch(BIND_EVENT_METH(mvImage::onTextureDeleted), mvEVT_DELETE_TEXTURE);
+		dispatcher.dispatch(BIND_EVENT_METH(mvImage::onTextureLoaded), mvEVT_TEXTURE_LOADED);
 
 		return event.handled;
 	}
 
+	bool mvImage::onTextureLoaded(mvEvent& event)
+	{
+		// placeholder was swapped for the uploaded texture
+		if (m_texture && GetEString(event, "NAME") == m_value)
+		{
+			if (mvTexture* texture = mvApp::GetApp()->getTextureStorage().getTexture(m_value))
+			{
+				m_texture = texture->texture;
+				m_texture_uv_min = texture->uv_min;
+				m_texture_uv_max = texture->uv_max;
+			}
+		}
+
+		// other items may share this texture
+		return false;
+	}
+
 	bool mvImage::onTextureDeleted(mvEvent& event)
 	{
 		std::string name = GetEString(event, "NAME");
@@ -58,6 +77,8 @@ namespace Marvel {
 			}
 			
 			m_texture = texture->texture;
+			m_texture_uv_min = texture->uv_min;
+			m_texture_uv_max = texture->uv_max;
 
 			if (m_width == 0) m_width = (int)((float)texture->width * (m_uv_max.x - m_uv_min.x));
 			if (m_height == 0) m_height = (int)((float)texture->height * (m_uv_max.y - m_uv_min.y));
@@ -77,7 +98,8 @@ namespace Marvel {
 
 		if (m_texture)
 		{
-			ImGui::Image(m_texture, ImVec2((float)m_width, (float)m_height), ImVec2(m_uv_min.x, m_uv_min.y), ImVec2(m_uv_max.x, m_uv_max.y),
+			ImGui::Image(m_texture, ImVec2((float)m_width, (float)m_height),
+				MapTextureUV(m_texture_uv_min, m_texture_uv_max, m_uv_min), MapTextureUV(m_texture_uv_min, m_texture_uv_max, m_uv_max),
 				ImVec4((float)m_tintColor.r, (float)m_tintColor.g, (float)m_tintColor.b, (float)m_tintColor.a),
 				ImVec4((float)m_borderColor.r, (float)m_borderColor.g, (float)m_borderColor.b, (float)m_borderColor.a));
 
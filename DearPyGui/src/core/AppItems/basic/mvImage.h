@@ -16,6 +16,7 @@ namespace Marvel {
 
 		bool onEvent(mvEvent& event) override;
 		bool onTextureDeleted(mvEvent& event);
+		bool onTextureLoaded (mvEvent& event);
 
 		~mvImage() override;
 
@@ -34,6 +35,8 @@ namespace Marvel {
 		mvColor     m_tintColor = {255, 255, 255, 255, true};
 		mvColor     m_borderColor = {0, 0, 0, 0, true};
 		void*       m_texture = nullptr;
+		mvVec2      m_texture_uv_min = { 0.0f, 0.0f }; // image area within m_texture
+		mvVec2      m_texture_uv_max = { 1.0f, 1.0f };
 		bool        m_dirty = false;
 
 	};
@@ -11,6 +11,7 @@ namespace Marvel {
 	{
 		m_description.ignoreSizeUpdate = true;
 		mvEventBus::Subscribe(this, mvEVT_DELETE_TEXTURE);
+		mvEventBus::Subscribe(this, mvEVT_TEXTURE_LOADED);
 	}
 
 	mvImageButton::~mvImageButton()
@@ -23,10 +24,28 @@ namespace Marvel {
 	{
 		mvEventDispatcher dispatcher(event);
 		dispatcher.dispatch(BIND_EVENT_METH(mvImageButton::onTextureDeleted), mvEVT_DELETE_TEXTURE);
+		dispatcher.dispatch(BIND_EVENT_METH(mvImageButton::onTextureLoaded), mvEVT_TEXTURE_LOADED);
 
 		return event.handled;
 	}
 
+	bool mvImageButton::onTextureLoaded(mvEvent& event)
+	{
+		// placeholder was swapped for the uploaded texture
+		if (m_texture && GetEString(event, "NAME") == m_value)
+		{
+			if (mvTexture* texture = mvApp::GetApp()->getTextureStorage().getTexture(m_value))
+			{
+				m_texture = texture->texture;
+				m_texture_uv_min = texture->uv_min;
+				m_texture_uv_max = texture->uv_max;
+			}
+		}
+
+		// other items may share this texture
+		return false;
+	}
+
 	bool mvImageButton::onTextureDeleted(mvEvent& event)
 	{
 		std::string name = GetEString(event, "NAME");
@@ -59,6 +78,8 @@ namespace Marvel {
 			if (m_height == 0) m_height = (int)((float)texture->height * (m_uv_max.y - m_uv_min.y));
 
 			m_texture = texture->texture;
+			m_texture_uv_min = texture->uv_min;
+			m_texture_uv_max = texture->uv_max;
 
 		}
 
@@ -76,7 +97,7 @@ namespace Marvel {
 		if (m_texture)
 		{
 			if (ImGui::ImageButton(m_texture, ImVec2((float)m_width, (float)m_height),
-				ImVec2(m_uv_min.x, m_uv_min.y), ImVec2(m_uv_max.x, m_uv_max.y), m_framePadding,
+				MapTextureUV(m_texture_uv_min, m_texture_uv_max, m_uv_min), MapTextureUV(m_texture_uv_min, m_texture_uv_max, m_uv_max), m_framePadding,
 				m_backgroundColor.toVec4(), m_tintColor.toVec4()))
 				mvCallbackRegistry::GetCallbackRegistry()->addCallback(m_callback, m_name, m_callbackData);
 
@@ -8,6 +8,10 @@
 #include "mvTextureStorage.h"
 #include "mvValueStorage.h"
 #include "mvPythonTranslator.h"
+#include "mvGlobalIntepreterLock.h"
+#include "mvCostTracker.h"
+#include "mvMemory.h"
+#include <algorithm>
 
 namespace Marvel {
 
@@ -32,6 +36,16 @@ namespace Marvel {
 		ImGui::TextColored(ImVec4(1.0f, 0.0f, 1.0f, 1.0f), "%s", (std::to_string(x) + ", " + std::to_string(y)).c_str());
 	}
 
+	static std::string FormatBytes(int64_t bytes)
+	{
+		char buffer[32];
+		if (bytes >= 1024 * 1024 || bytes <= -1024 * 1024)
+			snprintf(buffer, sizeof(buffer), "%.2f MB", (double)bytes / (1024.0 * 1024.0));
+		else
+			snprintf(buffer, sizeof(buffer), "%.2f KB", (double)bytes / 1024.0);
+		return buffer;
+	}
+
 	void mvDebugWindow::renderItem(mvAppItem* item)
 	{
 		
@@ -138,6 +152,8 @@ namespace Marvel {
 				DebugItem("Threadpool Timeout: ", std::to_string(tpool->getThreadPoolTimeout()).c_str());
 				DebugItem("Threadpool Active: ", tpool->usingThreadPool() ? ts : fs);
 				DebugItem("Threadpool High: ", tpool->usingThreadPoolHighPerformance() ? ts : fs);
+				DebugItem("GIL Ensure/Release: ", std::to_string(mvGlobalIntepreterLock::GetFrameEnsureCount()).c_str());
+				DebugItem("GIL Nested Skipped: ", std::to_string(mvGlobalIntepreterLock::GetFrameNestedCount()).c_str());
 				ImGui::Separator();
 				DebugItem("Int Values", std::to_string(mvApp::GetApp()->getValueStorage().s_ints.size()).c_str());
 				DebugItem("Int2 Values", std::to_string(mvApp::GetApp()->getValueStorage().s_int2s.size()).c_str());
@@ -285,6 +301,98 @@ namespace Marvel {
 				ImGui::EndTabItem();
 			}
 
+			if (ImGui::BeginTabItem("Frame Cost##debug"))
+			{
+				int interval = mvCostTracker::GetSampleInterval();
+				ImGui::PushItemWidth(200);
+				if (ImGui::InputInt("Sample Interval##debug", &interval))
+				{
+					mvCostTracker::SetSampleInterval(interval);
+					mvCostTracker::Reset();
+				}
+				ImGui::SameLine();
+				if (ImGui::Button("Clear##debugcost"))
+					mvCostTracker::Reset();
+				ImGui::SliderInt("Top##debugcost", &m_costTop, 5, 100);
+				ImGui::PopItemWidth();
+
+				std::vector<mvCost> costs = mvCostTracker::GetBreakdown();
+				switch (m_costSort)
+				{
+				case 1: std::stable_sort(costs.begin(), costs.end(), [](const mvCost& a, const mvCost& b) { return a.max > b.max; }); break;
+				case 2: std::stable_sort(costs.begin(), costs.end(), [](const mvCost& a, const mvCost& b) { return a.calls > b.calls; }); break;
+				case 3: std::stable_sort(costs.begin(), costs.end(), [](const mvCost& a, const mvCost& b) { return a.type < b.type; }); break;
+				case 4: std::stable_sort(costs.begin(), costs.end(), [](const mvCost& a, const mvCost& b) { return a.name < b.name; }); break;
+				default: break;
+				}
+				if ((int)costs.size() > m_costTop)
+					costs.resize(m_costTop);
+
+				// clicking a header sorts by that column
+				static const char* headers[] = { "Avg (ms)", "Max (ms)", "Calls", "Type", "Name" };
+				ImGui::Columns(5, "FrameCost##debug");
+				for (int i = 0; i < 5; i++)
+				{
+					if (ImGui::Selectable(headers[i], m_costSort == i))
+						m_costSort = i;
+					ImGui::NextColumn();
+				}
+				ImGui::Separator();
+
+				for (const auto& cost : costs)
+				{
+					ImGui::Text("%.3f", cost.average); ImGui::NextColumn();
+					ImGui::Text("%.3f", cost.max); ImGui::NextColumn();
+					ImGui::Text("%d", cost.calls); ImGui::NextColumn();
+					ImGui::Text("%s", mvCostTracker::GetTypeName(cost.type)); ImGui::NextColumn();
+					ImGui::TextColored(ImVec4(1.0f, 0.0f, 1.0f, 1.0f), "%s", cost.name.c_str()); ImGui::NextColumn();
+				}
+				ImGui::Columns(1);
+
+				if (interval == 0)
+					ImGui::Text("Sampling is off, set an interval to start.");
+
+				ImGui::EndTabItem();
+			}
+
+			if (ImGui::BeginTabItem("Memory##debug"))
+			{
+				mvMemory::Refresh();
+
+				if (ImGui::Button("Reset Peaks##debugmemory"))
+					mvMemory::ResetPeaks();
+
+				static const char* headers[] = { "Subsystem", "Current", "Peak", "Live Allocations", "Total Allocations" };
+				ImGui::Columns(5, "Memory##debug");
+				for (const char* header : headers)
+				{
+					ImGui::Text("%s", header);
+					ImGui::NextColumn();
+				}
+				ImGui::Separator();
+
+				int64_t total = 0;
+				for (int i = 0; i < (int)mvMemoryCategory::Count; i++)
+				{
+					mvMemoryStats stats = mvMemory::GetStats((mvMemoryCategory)i);
+					total += stats.bytes;
+
+					ImGui::TextColored(ImVec4(1.0f, 0.0f, 1.0f, 1.0f), "%s", mvMemory::GetCategoryName((mvMemoryCategory)i)); ImGui::NextColumn();
+					ImGui::Text("%s", FormatBytes(stats.bytes).c_str()); ImGui::NextColumn();
+					ImGui::Text("%s", FormatBytes(stats.peak).c_str()); ImGui::NextColumn();
+					ImGui::Text("%lld", (long long)stats.allocations); ImGui::NextColumn();
+					ImGui::Text("%llu", (unsigned long long)stats.totalAllocations); ImGui::NextColumn();
+				}
+				ImGui::Separator();
+				ImGui::Text("total"); ImGui::NextColumn();
+				ImGui::Text("%s", FormatBytes(total).c_str()); ImGui::NextColumn();
+				ImGui::Columns(1);
+
+				ImGui::Text("Textures count pixels waiting for upload, textures_gpu is estimated from size and format.");
+
+				ImGui::EndTabItem();
+			}
+
 			if (ImGui::BeginTabItem("Commands##debug"))
 			{
 
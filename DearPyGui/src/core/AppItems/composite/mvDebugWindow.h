@@ -28,6 +28,8 @@ namespace Marvel {
 
 		std::string m_selectedItem;
 		ImGuiID     m_selectedID;
+		int         m_costSort = 0;
+		int         m_costTop = 20;
 		std::vector<std::pair<std::string, std::string>> m_commands;
 	};
 
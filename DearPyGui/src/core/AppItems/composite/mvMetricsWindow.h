@@ -2,6 +2,7 @@
 #include "mvTypeBases.h"
 #include "mvAppItem.h"
 #include "mvInput.h"
+#include "mvFrameStats.h"
 
 namespace Marvel {
 
@@ -31,6 +32,33 @@ namespace Marvel {
 			ImGui::Text("%d active windows (%d visible)", io.MetricsActiveWindows, io.MetricsRenderWindows);
 			ImGui::Text("%d active allocations", io.MetricsActiveAllocations);
 
+			ImGui::Separator();
+			ImGui::Text("%llu frames, %llu dropped (target %.0f FPS)",
+				(unsigned long long)mvFrameStats::GetSummary(mvFramePhase::Frame).count,
+				(unsigned long long)mvFrameStats::GetDroppedFrames(), mvFrameStats::GetTargetFps());
+			ImGui::SameLine();
+			if (ImGui::SmallButton("Reset##metrics"))
+				mvFrameStats::Reset(mvFrameStats::GetTargetFps());
+
+			ImGui::Columns(6, "FrameStats##metrics");
+			for (const char* header : { "ms", "p50", "p95", "p99", "max", "mean" })
+			{
+				ImGui::Text("%s", header);
+				ImGui::NextColumn();
+			}
+			ImGui::Separator();
+			for (int i = 0; i < (int)mvFramePhase::Count; i++)
+			{
+				mvFrameStats::Summary summary = mvFrameStats::GetSummary((mvFramePhase)i);
+				ImGui::Text("%s", mvFrameStats::GetPhaseName((mvFramePhase)i)); ImGui::NextColumn();
+				ImGui::Text("%.3f", summary.p50); ImGui::NextColumn();
+				ImGui::Text("%.3f", summary.p95); ImGui::NextColumn();
+				ImGui::Text("%.3f", summary.p99); ImGui::NextColumn();
+				ImGui::Text("%.3f", summary.max); ImGui::NextColumn();
+				ImGui::Text("%.3f", summary.mean); ImGui::NextColumn();
+			}
+			ImGui::Columns(1);
+
 			if (ImGui::IsWindowFocused())
 			{
 
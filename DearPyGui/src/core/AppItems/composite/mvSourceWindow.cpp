@@ -90,10 +90,8 @@ namespace Marvel {
 			if (getMouseMoveCallback() != nullptr)
 			{
 				if (oldMousePos.x != mousePos.x || oldMousePos.y != mousePos.y)
-				{
-					mvCallbackRegistry::GetCallbackRegistry()->runCallback(getMouseMoveCallback(), m_name,
-						ToPyPair(x, y));
-				}
+					mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_MOVE,
+						{ CreateEventArgument("WINDOW", m_name), CreateEventArgument("X", x), CreateEventArgument("Y", y) });
 			}
 
 		}
@@ -1,6 +1,7 @@
 #include "mvColumns.h"
 #include "mvPythonTranslator.h"
 #include "mvGlobalIntepreterLock.h"
+#include "mvCostTracker.h"
 
 namespace Marvel {
 
@@ -54,6 +55,7 @@ namespace Marvel {
 				ImGui::SetNextItemWidth((float)item->m_width);
 
 			//item->pushColorStyles();
+			mvCostScope cost(item->m_name);
 			item->draw();
 			//item->popColorStyles();
 
@@ -2,6 +2,7 @@
 
 #include "mvMenuBar.h"
 #include "mvApp.h"
+#include "mvCostTracker.h"
 
 namespace Marvel {
 
@@ -34,6 +35,7 @@ namespace Marvel {
 				if (item->m_width != 0)
 					ImGui::SetNextItemWidth((float)item->m_width);
 
+				mvCostScope cost(item->m_name);
 				item->draw();
 
 				// Regular Tooltip (simple)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "mvTypeBases.h"
+#include "mvCostTracker.h"
 
 namespace Marvel {
 
@@ -51,6 +52,7 @@ namespace Marvel {
 						if (item->m_width != 0)
 							ImGui::SetNextItemWidth((float)item->m_width);
 
+						mvCostScope cost(item->m_name);
 						item->draw();
 
 						// Regular Tooltip (simple)
@@ -79,6 +81,7 @@ namespace Marvel {
 						if (item->m_width > 0)
 							ImGui::SetNextItemWidth((float)item->m_width);
 
+						mvCostScope cost(item->m_name);
 						item->draw();
 
 						item->getState().update();
@@ -2,6 +2,7 @@
 #include "mvApp.h"
 #include "mvPythonTranslator.h"
 #include "mvGlobalIntepreterLock.h"
+#include "mvCostTracker.h"
 
 namespace Marvel {
 
@@ -40,6 +41,7 @@ namespace Marvel {
 				if (item->m_width != 0)
 					ImGui::SetNextItemWidth((float)item->m_width);
 
+				mvCostScope cost(item->m_name);
 				item->draw();
 
 				// Regular Tooltip (simple)
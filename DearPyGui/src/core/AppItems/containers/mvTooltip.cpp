@@ -1,4 +1,5 @@
 #include "mvTooltip.h"
+#include "mvCostTracker.h"
 
 namespace Marvel {
 
@@ -30,6 +31,7 @@ namespace Marvel {
 				if (item->m_width != 0)
 					ImGui::SetNextItemWidth((float)item->m_width);
 
+				mvCostScope cost(item->m_name);
 				item->draw();
 
 				// Regular Tooltip (simple)
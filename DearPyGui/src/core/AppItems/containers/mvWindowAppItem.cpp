@@ -3,6 +3,7 @@
 #include "mvInput.h"
 #include "mvPythonTranslator.h"
 #include "mvGlobalIntepreterLock.h"
+#include "mvCostTracker.h"
 
 namespace Marvel {
 
@@ -159,6 +160,7 @@ namespace Marvel {
 				if (item->m_width != 0)
 					ImGui::SetNextItemWidth((float)item->m_width);
 
+				mvCostScope cost(item->m_name);
 				item->draw();
 
 				// Regular Tooltip (simple)
@@ -201,12 +203,10 @@ namespace Marvel {
 				if (mvApp::GetApp()->getItemRegistry().getActiveWindow() != m_name)
 					mvEventBus::Publish(mvEVT_CATEGORY_ITEM, mvEVT_ACTIVE_WINDOW, { CreateEventArgument("WINDOW", m_name) });
 
-				// mouse move callback
-				//if (oldMousePos.x != mousePos.x || oldMousePos.y != mousePos.y)
-				//{
-				//	mvCallbackRegistry::GetCallbackRegistry()->runCallback(mvApp::GetApp()->getMouseMoveCallback(), m_name,
-				//		ToPyPair(x, y));
-				//}
+				// mouse move callback (coalesced by the callback registry)
+				if (oldMousePos.x != mousePos.x || oldMousePos.y != mousePos.y)
+					mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_MOVE,
+						{ CreateEventArgument("WINDOW", m_name), CreateEventArgument("X", x), CreateEventArgument("Y", y) });
 
 			}
 
@@ -30,6 +30,9 @@ bool equals(InputIt1 first1, InputIt1 last1,
 mvTextEditor::mvTextEditor()
 	: mLineSpacing(1.0f)
 	, mUndoIndex(0)
+	, mUndoTextBase(0)
+	, mUndoMaxRecords(1000)
+	, mUndoMaxBytes(16 * 1024 * 1024)
 	, mTabSize(4)
 	, mOverwrite(false)
 	, mReadOnly(false)
@@ -260,13 +263,13 @@ void mvTextEditor::DeleteRange(const Coordinates& aStart, const Coordinates& aEn
 	mTextChanged = true;
 }
 
-int mvTextEditor::InsertTextAt(Coordinates& /* inout */ aWhere, const char* aValue)
+int mvTextEditor::InsertTextAt(Coordinates& /* inout */ aWhere, const char* aValue, const char* aValueEnd)
 {
 	assert(!mReadOnly);
 
 	int cindex = GetCharacterIndex(aWhere);
 	int totalLines = 0;
-	while (*aValue != '\0')
+	while (aValue != aValueEnd && *aValue != '\0')
 	{
 		assert(!mLines.empty());
 
@@ -298,7 +301,7 @@ int mvTextEditor::InsertTextAt(Coordinates& /* inout */ aWhere, const char* aVal
 		{
 			auto& line = mLines[aWhere.mLine];
 			auto d = UTF8CharLength(*aValue);
-			while (d-- > 0 && *aValue != '\0')
+			while (d-- > 0 && aValue != aValueEnd && *aValue != '\0')
 				line.insert(line.begin() + cindex++, Glyph(*aValue++, PaletteIndex::Default));
 			++aWhere.mColumn;
 		}
@@ -309,19 +312,118 @@ int mvTextEditor::InsertTextAt(Coordinates& /* inout */ aWhere, const char* aVal
 	return totalLines;
 }
 
-void mvTextEditor::AddUndo(UndoRecord& aValue)
+void mvTextEditor::AddUndo(UndoRecord& aValue, const std::string& aAdded, const std::string& aRemoved, bool aCoalesce)
 {
 	assert(!mReadOnly);
-	//printf("AddUndo: (@%d.%d) +\'%s' [%d.%d .. %d.%d], -\'%s', [%d.%d .. %d.%d] (@%d.%d)\n",
-	//	aValue.mBefore.mCursorPosition.mLine, aValue.mBefore.mCursorPosition.mColumn,
-	//	aValue.mAdded.c_str(), aValue.mAddedStart.mLine, aValue.mAddedStart.mColumn, aValue.mAddedEnd.mLine, aValue.mAddedEnd.mColumn,
-	//	aValue.mRemoved.c_str(), aValue.mRemovedStart.mLine, aValue.mRemovedStart.mColumn, aValue.mRemovedEnd.mLine, aValue.mRemovedEnd.mColumn,
-	//	aValue.mAfter.mCursorPosition.mLine, aValue.mAfter.mCursorPosition.mColumn
-	//	);
-
-	mUndoBuffer.resize((size_t)(mUndoIndex + 1));
-	mUndoBuffer.back() = aValue;
+
+	// drop the redo tail along with the text only it referenced
+	mUndoBuffer.resize((size_t)mUndoIndex);
+	if (mUndoBuffer.empty())
+	{
+		mUndoText.clear();
+		mUndoTextBase = 0;
+	}
+	else
+	{
+		const UndoRecord& last = mUndoBuffer.back();
+		mUndoText.resize(last.mAddedOffset + last.mAddedLength - mUndoTextBase);
+	}
+
+	if (aCoalesce && CoalesceUndo(aValue, aAdded))
+		return;
+
+	// removed text is always stored ahead of added text (see TrimUndo)
+	aValue.mRemovedOffset = mUndoTextBase + mUndoText.size();
+	aValue.mRemovedLength = aRemoved.size();
+	mUndoText.append(aRemoved);
+
+	aValue.mAddedOffset = mUndoTextBase + mUndoText.size();
+	aValue.mAddedLength = aAdded.size();
+	mUndoText.append(aAdded);
+
+	aValue.mCoalescable = aCoalesce;
+
+	mUndoBuffer.push_back(aValue);
 	++mUndoIndex;
+
+	TrimUndo();
+}
+
+bool mvTextEditor::CoalesceUndo(const UndoRecord& aValue, const std::string& aAdded)
+{
+	if (mUndoBuffer.empty() || aAdded.empty())
+		return false;
+
+	UndoRecord& last = mUndoBuffer.back();
+
+	if (!last.mCoalescable || last.mAddedLength == 0)
+		return false;
+
+	// only extend a run that this record continues exactly
+	if (last.mAddedEnd != aValue.mAddedStart || last.mAfter.mCursorPosition != aValue.mBefore.mCursorPosition)
+		return false;
+
+	// start a new record at each word so undo steps stay useful
+	const char previous = *GetUndoText(last.mAddedOffset + last.mAddedLength - 1);
+	if (isascii(previous) && isblank(previous) && !(isascii(aAdded[0]) && isblank(aAdded[0])))
+		return false;
+
+	mUndoText.append(aAdded);
+	last.mAddedLength += aAdded.size();
+	last.mAddedEnd = aValue.mAddedEnd;
+	last.mAfter = aValue.mAfter;
+
+	TrimUndo();
+	return true;
+}
+
+void mvTextEditor::TrimUndo()
+{
+	// records waiting to be redone are never dropped from the front
+	while (mUndoBuffer.size() > 1 && mUndoIndex > 0 &&
+		(mUndoBuffer.size() > mUndoMaxRecords || GetUndoMemoryUsage() > mUndoMaxBytes))
+	{
+		mUndoBuffer.pop_front();
+		--mUndoIndex;
+	}
+
+	// release the text of dropped records once it makes up half the store
+	const size_t liveStart = mUndoBuffer.front().mRemovedOffset;
+	const size_t dead = liveStart - mUndoTextBase;
+	if (dead > 4096 && dead > mUndoText.size() / 2)
+	{
+		mUndoText.erase(0, dead);
+		mUndoTextBase = liveStart;
+		if (mUndoText.capacity() > 2 * mUndoText.size())
+			mUndoText.shrink_to_fit();
+	}
+}
+
+void mvTextEditor::ClearUndo()
+{
+	mUndoBuffer.clear();
+	mUndoIndex = 0;
+	mUndoText.clear();
+	mUndoText.shrink_to_fit();
+	mUndoTextBase = 0;
+}
+
+void mvTextEditor::SetUndoLimits(size_t aMaxRecords, size_t aMaxBytes)
+{
+	mUndoMaxRecords = aMaxRecords > 0 ? aMaxRecords : 1;
+	mUndoMaxBytes = aMaxBytes;
+
+	if (!mUndoBuffer.empty())
+		TrimUndo();
+}
+
+size_t mvTextEditor::GetUndoMemoryUsage() const
+{
+	if (mUndoBuffer.empty())
+		return 0;
+
+	const size_t liveText = mUndoTextBase + mUndoText.size() - mUndoBuffer.front().mRemovedOffset;
+	return liveText + mUndoBuffer.size() * sizeof(UndoRecord);
 }
 
 mvTextEditor::Coordinates mvTextEditor::ScreenPosToCoordinates(const ImVec2& aPosition) const
@@ -1178,8 +1280,7 @@ void mvTextEditor::SetText(const std::string& aText)
 	mTextChanged = true;
 	mScrollToTop = true;
 
-	mUndoBuffer.clear();
-	mUndoIndex = 0;
+	ClearUndo();
 
 	Colorize();
 }
@@ -1209,8 +1310,7 @@ void mvTextEditor::SetTextLines(const std::vector<std::string>& aLines)
 	mTextChanged = true;
 	mScrollToTop = true;
 
-	mUndoBuffer.clear();
-	mUndoIndex = 0;
+	ClearUndo();
 
 	Colorize();
 }
@@ -1220,6 +1320,8 @@ void mvTextEditor::EnterCharacter(ImWchar aChar, bool aShift)
 	assert(!mReadOnly);
 
 	UndoRecord u;
+	std::string added;
+	std::string removed;
 
 	u.mBefore = mState;
 
@@ -1247,7 +1349,7 @@ void mvTextEditor::EnterCharacter(ImWchar aChar, bool aShift)
 
 			u.mRemovedStart = start;
 			u.mRemovedEnd = end;
-			u.mRemoved = GetText(start, end);
+			removed = GetText(start, end);
 
 			bool modified = false;
 
@@ -1288,13 +1390,13 @@ void mvTextEditor::EnterCharacter(ImWchar aChar, bool aShift)
 				{
 					end = Coordinates(end.mLine, GetLineMaxColumn(end.mLine));
 					rangeEnd = end;
-					u.mAdded = GetText(start, end);
+					added = GetText(start, end);
 				}
 				else
 				{
 					end = Coordinates(originalEnd.mLine, 0);
 					rangeEnd = Coordinates(end.mLine - 1, GetLineMaxColumn(end.mLine - 1));
-					u.mAdded = GetText(start, rangeEnd);
+					added = GetText(start, rangeEnd);
 				}
 
 				u.mAddedStart = start;
@@ -1303,7 +1405,7 @@ void mvTextEditor::EnterCharacter(ImWchar aChar, bool aShift)
 
 				mState.mSelectionStart = start;
 				mState.mSelectionEnd = end;
-				AddUndo(u);
+				AddUndo(u, added, removed);
 
 				mTextChanged = true;
 
@@ -1314,7 +1416,7 @@ void mvTextEditor::EnterCharacter(ImWchar aChar, bool aShift)
 		} // c == '\t'
 		else
 		{
-			u.mRemoved = GetSelectedText();
+			removed = GetSelectedText();
 			u.mRemovedStart = mState.mSelectionStart;
 			u.mRemovedEnd = mState.mSelectionEnd;
 			DeleteSelection();
@@ -1341,7 +1443,7 @@ void mvTextEditor::EnterCharacter(ImWchar aChar, bool aShift)
 		newLine.insert(newLine.end(), line.begin() + cindex, line.end());
 		line.erase(line.begin() + cindex, line.begin() + line.size());
 		SetCursorPosition(Coordinates(coord.mLine + 1, GetCharacterColumn(coord.mLine + 1, (int)whitespaceSize)));
-		u.mAdded = (char)aChar;
+		added = (char)aChar;
 	}
 	else
 	{
@@ -1362,14 +1464,14 @@ void mvTextEditor::EnterCharacter(ImWchar aChar, bool aShift)
 
 				while (d-- > 0 && cindex < (int)line.size())
 				{
-					u.mRemoved += line[cindex].mChar;
+					removed += line[cindex].mChar;
 					line.erase(line.begin() + cindex);
 				}
 			}
 
 			for (auto p = buf; *p != '\0'; p++, ++cindex)
 				line.insert(line.begin() + cindex, Glyph(*p, PaletteIndex::Default));
-			u.mAdded = buf;
+			added = buf;
 
 			SetCursorPosition(Coordinates(coord.mLine, GetCharacterColumn(coord.mLine, cindex)));
 		}
@@ -1382,7 +1484,8 @@ void mvTextEditor::EnterCharacter(ImWchar aChar, bool aShift)
 	u.mAddedEnd = GetActualCursorCoordinates();
 	u.mAfter = mState;
 
-	AddUndo(u);
+	// consecutive typing collapses into a single record
+	AddUndo(u, added, removed, removed.empty() && aChar != '\n');
 
 	Colorize(coord.mLine - 1, 3);
 	EnsureCursorVisible();
@@ -1767,11 +1870,12 @@ void mvTextEditor::Delete()
 		return;
 
 	UndoRecord u;
+	std::string removed;
 	u.mBefore = mState;
 
 	if (HasSelection())
 	{
-		u.mRemoved = GetSelectedText();
+		removed = GetSelectedText();
 		u.mRemovedStart = mState.mSelectionStart;
 		u.mRemovedEnd = mState.mSelectionEnd;
 
@@ -1788,7 +1892,7 @@ void mvTextEditor::Delete()
 			if (pos.mLine == (int)mLines.size() - 1)
 				return;
 
-			u.mRemoved = '\n';
+			removed = '\n';
 			u.mRemovedStart = u.mRemovedEnd = GetActualCursorCoordinates();
 			Advance(u.mRemovedEnd);
 
@@ -1801,7 +1905,7 @@ void mvTextEditor::Delete()
 			auto cindex = GetCharacterIndex(pos);
 			u.mRemovedStart = u.mRemovedEnd = GetActualCursorCoordinates();
 			u.mRemovedEnd.mColumn++;
-			u.mRemoved = GetText(u.mRemovedStart, u.mRemovedEnd);
+			removed = GetText(u.mRemovedStart, u.mRemovedEnd);
 
 			auto d = UTF8CharLength(line[cindex].mChar);
 			while (d-- > 0 && cindex < (int)line.size())
@@ -1814,7 +1918,7 @@ void mvTextEditor::Delete()
 	}
 
 	u.mAfter = mState;
-	AddUndo(u);
+	AddUndo(u, std::string(), removed);
 }
 
 void mvTextEditor::Backspace()
@@ -1825,11 +1929,12 @@ void mvTextEditor::Backspace()
 		return;
 
 	UndoRecord u;
+	std::string removed;
 	u.mBefore = mState;
 
 	if (HasSelection())
 	{
-		u.mRemoved = GetSelectedText();
+		removed = GetSelectedText();
 		u.mRemovedStart = mState.mSelectionStart;
 		u.mRemovedEnd = mState.mSelectionEnd;
 
@@ -1845,7 +1950,7 @@ void mvTextEditor::Backspace()
 			if (mState.mCursorPosition.mLine == 0)
 				return;
 
-			u.mRemoved = '\n';
+			removed = '\n';
 			u.mRemovedStart = u.mRemovedEnd = Coordinates(pos.mLine - 1, GetLineMaxColumn(pos.mLine - 1));
 			Advance(u.mRemovedEnd);
 
@@ -1880,7 +1985,7 @@ void mvTextEditor::Backspace()
 
 			while (cindex < line.size() && cend-- > cindex)
 			{
-				u.mRemoved += line[cindex].mChar;
+				removed += line[cindex].mChar;
 				line.erase(line.begin() + cindex);
 			}
 		}
@@ -1892,7 +1997,7 @@ void mvTextEditor::Backspace()
 	}
 
 	u.mAfter = mState;
-	AddUndo(u);
+	AddUndo(u, std::string(), removed);
 }
 
 void mvTextEditor::SelectWordUnderCursor()
@@ -1942,7 +2047,7 @@ void mvTextEditor::Cut()
 		{
 			UndoRecord u;
 			u.mBefore = mState;
-			u.mRemoved = GetSelectedText();
+			const std::string removed = GetSelectedText();
 			u.mRemovedStart = mState.mSelectionStart;
 			u.mRemovedEnd = mState.mSelectionEnd;
 
@@ -1950,7 +2055,7 @@ void mvTextEditor::Cut()
 			DeleteSelection();
 
 			u.mAfter = mState;
-			AddUndo(u);
+			AddUndo(u, std::string(), removed);
 		}
 	}
 }
@@ -1964,24 +2069,24 @@ void mvTextEditor::Paste()
 	if (clipText != nullptr && strlen(clipText) > 0)
 	{
 		UndoRecord u;
+		std::string removed;
 		u.mBefore = mState;
 
 		if (HasSelection())
 		{
-			u.mRemoved = GetSelectedText();
+			removed = GetSelectedText();
 			u.mRemovedStart = mState.mSelectionStart;
 			u.mRemovedEnd = mState.mSelectionEnd;
 			DeleteSelection();
 		}
 
-		u.mAdded = clipText;
 		u.mAddedStart = GetActualCursorCoordinates();
 
 		InsertText(clipText);
 
 		u.mAddedEnd = GetActualCursorCoordinates();
 		u.mAfter = mState;
-		AddUndo(u);
+		AddUndo(u, clipText, removed);
 	}
 }
 
@@ -2460,40 +2565,19 @@ int mvTextEditor::GetPageSize() const
 	return (int)floor(height / mCharAdvance.y);
 }
 
-mvTextEditor::UndoRecord::UndoRecord(
-	const std::string& aAdded,
-	const mvTextEditor::Coordinates aAddedStart,
-	const mvTextEditor::Coordinates aAddedEnd,
-	const std::string& aRemoved,
-	const mvTextEditor::Coordinates aRemovedStart,
-	const mvTextEditor::Coordinates aRemovedEnd,
-	mvTextEditor::EditorState& aBefore,
-	mvTextEditor::EditorState& aAfter)
-	: mAdded(aAdded)
-	, mAddedStart(aAddedStart)
-	, mAddedEnd(aAddedEnd)
-	, mRemoved(aRemoved)
-	, mRemovedStart(aRemovedStart)
-	, mRemovedEnd(aRemovedEnd)
-	, mBefore(aBefore)
-	, mAfter(aAfter)
-{
-	assert(mAddedStart <= mAddedEnd);
-	assert(mRemovedStart <= mRemovedEnd);
-}
-
 void mvTextEditor::UndoRecord::Undo(mvTextEditor* aEditor)
 {
-	if (!mAdded.empty())
+	if (mAddedLength > 0)
 	{
 		aEditor->DeleteRange(mAddedStart, mAddedEnd);
 		aEditor->Colorize(mAddedStart.mLine - 1, mAddedEnd.mLine - mAddedStart.mLine + 2);
 	}
 
-	if (!mRemoved.empty())
+	if (mRemovedLength > 0)
 	{
 		auto start = mRemovedStart;
-		aEditor->InsertTextAt(start, mRemoved.c_str());
+		const char* text = aEditor->GetUndoText(mRemovedOffset);
+		aEditor->InsertTextAt(start, text, text + mRemovedLength);
 		aEditor->Colorize(mRemovedStart.mLine - 1, mRemovedEnd.mLine - mRemovedStart.mLine + 2);
 	}
 
@@ -2504,16 +2588,17 @@ void mvTextEditor::UndoRecord::Undo(mvTextEditor* aEditor)
 
 void mvTextEditor::UndoRecord::Redo(mvTextEditor* aEditor)
 {
-	if (!mRemoved.empty())
+	if (mRemovedLength > 0)
 	{
 		aEditor->DeleteRange(mRemovedStart, mRemovedEnd);
 		aEditor->Colorize(mRemovedStart.mLine - 1, mRemovedEnd.mLine - mRemovedStart.mLine + 1);
 	}
 
-	if (!mAdded.empty())
+	if (mAddedLength > 0)
 	{
 		auto start = mAddedStart;
-		aEditor->InsertTextAt(start, mAdded.c_str());
+		const char* text = aEditor->GetUndoText(mAddedOffset);
+		aEditor->InsertTextAt(start, text, text + mAddedLength);
 		aEditor->Colorize(mAddedStart.mLine - 1, mAddedEnd.mLine - mAddedStart.mLine + 1);
 	}
 
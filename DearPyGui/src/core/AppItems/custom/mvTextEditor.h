@@ -18,6 +18,7 @@
 #include <unordered_set>
 #include <unordered_map>
 #include <map>
+#include <deque>
 #include <regex>
 #include "imgui.h"
 
@@ -202,7 +203,12 @@ namespace Marvel {
 		mvTextEditor();
 		~mvTextEditor();
 
-		void ClearUndo() { mUndoBuffer.clear(); mUndoIndex = 0; }
+		void ClearUndo();
+
+		// undo history is dropped oldest first once either limit is exceeded
+		// (the most recent record is always kept)
+		void   SetUndoLimits(size_t aMaxRecords, size_t aMaxBytes);
+		size_t GetUndoMemoryUsage() const;
 
 		void SetLanguageDefinition(const LanguageDefinition& aLanguageDef);
 		const LanguageDefinition& GetLanguageDefinition() const { return mLanguageDefinition; }
@@ -296,40 +302,36 @@ namespace Marvel {
 			Coordinates mCursorPosition;
 		};
 
+		//-----------------------------------------------------------------------------
+		// UndoRecord
+		//     - text is not owned by the record, offsets refer to mUndoText
+		//-----------------------------------------------------------------------------
 		class UndoRecord
 		{
 		public:
 			UndoRecord() {}
 			~UndoRecord() {}
 
-			UndoRecord(
-				const std::string& aAdded,
-				const mvTextEditor::Coordinates aAddedStart,
-				const mvTextEditor::Coordinates aAddedEnd,
-
-				const std::string& aRemoved,
-				const mvTextEditor::Coordinates aRemovedStart,
-				const mvTextEditor::Coordinates aRemovedEnd,
-
-				mvTextEditor::EditorState& aBefore,
-				mvTextEditor::EditorState& aAfter);
-
 			void Undo(mvTextEditor* aEditor);
 			void Redo(mvTextEditor* aEditor);
 
-			std::string mAdded;
+			size_t      mAddedOffset = 0;
+			size_t      mAddedLength = 0;
 			Coordinates mAddedStart;
 			Coordinates mAddedEnd;
 
-			std::string mRemoved;
+			size_t      mRemovedOffset = 0;
+			size_t      mRemovedLength = 0;
 			Coordinates mRemovedStart;
 			Coordinates mRemovedEnd;
 
 			EditorState mBefore;
 			EditorState mAfter;
+
+			bool        mCoalescable = false; // plain typing, may be extended
 		};
 
-		typedef std::vector<UndoRecord> UndoBuffer;
+		typedef std::deque<UndoRecord> UndoBuffer;
 
 		void ProcessInputs();
 		void Colorize(int aFromLine = 0, int aCount = -1);
@@ -343,8 +345,11 @@ namespace Marvel {
 		Coordinates SanitizeCoordinates(const Coordinates& aValue) const;
 		void Advance(Coordinates& aCoordinates) const;
 		void DeleteRange(const Coordinates& aStart, const Coordinates& aEnd);
-		int InsertTextAt(Coordinates& aWhere, const char* aValue);
-		void AddUndo(UndoRecord& aValue);
+		int InsertTextAt(Coordinates& aWhere, const char* aValue, const char* aValueEnd = nullptr);
+		void AddUndo(UndoRecord& aValue, const std::string& aAdded, const std::string& aRemoved, bool aCoalesce = false);
+		bool CoalesceUndo(const UndoRecord& aValue, const std::string& aAdded);
+		void TrimUndo();
+		const char* GetUndoText(size_t aOffset) const { return mUndoText.data() + (aOffset - mUndoTextBase); }
 		Coordinates ScreenPosToCoordinates(const ImVec2& aPosition) const;
 		Coordinates FindWordStart(const Coordinates& aFrom) const;
 		Coordinates FindWordEnd(const Coordinates& aFrom) const;
@@ -373,6 +378,10 @@ namespace Marvel {
 		EditorState mState;
 		UndoBuffer mUndoBuffer;
 		int mUndoIndex;
+		std::string mUndoText;              // append-only store for undo record text
+		size_t mUndoTextBase;               // logical offset of mUndoText[0]
+		size_t mUndoMaxRecords;
+		size_t mUndoMaxBytes;
 
 		int mTabSize;
 		bool mOverwrite;
@@ -12,6 +12,8 @@ namespace Marvel{
 	mvAppItem::mvAppItem(const std::string& name)
 	{
 		m_name = name;
+		m_id = mvIdentifier(name);
+		mvIdentifier::Retain(m_id);
 		m_label = name;
 		m_state.setParent(this);
 	}
@@ -51,15 +53,21 @@ namespace Marvel{
 		if (dict == nullptr)
 			return;
 		mvGlobalIntepreterLock gil;
-		if (PyObject* item = PyDict_GetItemString(dict, "name")) m_name = ToString(item);
-		if (PyObject* item = PyDict_GetItemString(dict, "label")) setLabel(ToString(item));
-		if (PyObject* item = PyDict_GetItemString(dict, "popup")) m_popup = ToString(item);
-		if (PyObject* item = PyDict_GetItemString(dict, "tip")) m_tip =ToString(item);
-		if (PyObject* item = PyDict_GetItemString(dict, "width")) setWidth(ToInt(item));
-		if (PyObject* item = PyDict_GetItemString(dict, "height")) setHeight(ToInt(item));
-		if (PyObject* item = PyDict_GetItemString(dict, "show")) m_show = ToBool(item);
-		if (PyObject* item = PyDict_GetItemString(dict, "source")) setDataSource(ToString(item));
-		if (PyObject* item = PyDict_GetItemString(dict, "enabled")) setEnabled(ToBool(item));
+		if (PyObject* item = PyDict_GetItemString(dict, "name"))
+		{
+			m_name = ToString(item, gil);
+			mvIdentifier::Release(m_id);
+			m_id = mvIdentifier(m_name);
+			mvIdentifier::Retain(m_id);
+		}
+		if (PyObject* item = PyDict_GetItemString(dict, "label")) setLabel(ToString(item, gil));
+		if (PyObject* item = PyDict_GetItemString(dict, "popup")) m_popup = ToString(item, gil);
+		if (PyObject* item = PyDict_GetItemString(dict, "tip")) m_tip =ToString(item, gil);
+		if (PyObject* item = PyDict_GetItemString(dict, "width")) setWidth(ToInt(item, gil));
+		if (PyObject* item = PyDict_GetItemString(dict, "height")) setHeight(ToInt(item, gil));
+		if (PyObject* item = PyDict_GetItemString(dict, "show")) m_show = ToBool(item, gil);
+		if (PyObject* item = PyDict_GetItemString(dict, "source")) setDataSource(ToString(item, gil));
+		if (PyObject* item = PyDict_GetItemString(dict, "enabled")) setEnabled(ToBool(item, gil));
 	}
 
 	void mvAppItem::getConfigDict(PyObject* dict)
@@ -67,15 +75,15 @@ namespace Marvel{
 		if (dict == nullptr)
 			return;
 		mvGlobalIntepreterLock gil;
-		PyDict_SetItemString(dict, "name",    ToPyString(m_name));
-		PyDict_SetItemString(dict, "label",   ToPyString(m_label));
-		PyDict_SetItemString(dict, "source",  ToPyString(m_dataSource));
-		PyDict_SetItemString(dict, "popup",   ToPyString(m_popup));
-		PyDict_SetItemString(dict, "tip",     ToPyString(m_tip));
-		PyDict_SetItemString(dict, "show",    ToPyBool  (m_show));
-		PyDict_SetItemString(dict, "enabled", ToPyBool  (m_enabled));
-		PyDict_SetItemString(dict, "width",   ToPyInt   (m_width));
-		PyDict_SetItemString(dict, "height",  ToPyInt   (m_height));
+		PyDict_SetItemString(dict, "name",    ToPyString(m_name, gil));
+		PyDict_SetItemString(dict, "label",   ToPyString(m_label, gil));
+		PyDict_SetItemString(dict, "source",  ToPyString(m_dataSource, gil));
+		PyDict_SetItemString(dict, "popup",   ToPyString(m_popup, gil));
+		PyDict_SetItemString(dict, "tip",     ToPyString(m_tip, gil));
+		PyDict_SetItemString(dict, "show",    ToPyBool  (m_show, gil));
+		PyDict_SetItemString(dict, "enabled", ToPyBool  (m_enabled, gil));
+		PyDict_SetItemString(dict, "width",   ToPyInt   (m_width, gil));
+		PyDict_SetItemString(dict, "height",  ToPyInt   (m_height, gil));
 	}
 
 	void mvAppItem::registerWindowFocusing()
@@ -123,92 +131,7 @@ namespace Marvel{
 
 	}
 
-	bool  mvAppItem::moveChildUp(const std::string& name)
-	{
-		bool found = false;
-		int index = 0;
-
-		// check children
-		for (size_t i = 0; i<m_children.size(); i++)
-		{
-
-			if (m_children[i]->m_name == name)
-			{
-				found = true;
-				index = (int)i;
-				break;
-			}
-
-			if (m_children[i]->getDescription().container)
-			{
-				found = m_children[i]->moveChildUp(name);
-				if (found)
-					return true;
-			}
-
-		}
-
-		if (found)
-		{
-			if (index > 0)
-			{
-				auto upperitem = m_children[index - 1];
-				auto loweritem = m_children[index];
-
-				m_children[index] = upperitem;
-				m_children[index-1] = loweritem;
-			}
-
-			return true;
-		}
-
-		return false;
-
-	}
-
-	bool  mvAppItem::moveChildDown(const std::string& name)
-	{
-		bool found = false;
-		size_t index = 0;
-
-		// check children
-		for (size_t i = 0; i < m_children.size(); i++)
-		{
-
-			if (m_children[i]->m_name == name)
-			{
-				found = true;
-				index = i;
-				break;
-			}
-
-			if (m_children[i]->getDescription().container)
-			{
-				found = m_children[i]->moveChildDown(name);
-				if (found)
-					return true;
-			}
-
-		}
-
-		if (found)
-		{
-			if (index < m_children.size()-1)
-			{
-				auto upperitem = m_children[index];
-				auto loweritem = m_children[index+1];
-
-				m_children[index] = loweritem;
-				m_children[index + 1] = upperitem;
-			}
-
-			return true;
-		}
-
-		return false;
-	}
-
-	bool mvAppItem::addRuntimeChild(const std::string& parent, const std::string& before, mvAppItem* item)
+	bool mvAppItem::addRuntimeChild(mvIdentifier parent, mvIdentifier before, mvAppItem* item)
 	{
 		if (before.empty() && parent.empty())
 			return false;
@@ -216,7 +139,7 @@ namespace Marvel{
 		//this is the container, add item to beginning.
 		if (before.empty())
 		{
-			if (parent == m_name)
+			if (parent == m_id)
 			{
 				m_children.push_back(item);
 				item->m_parent = this;
@@ -246,7 +169,7 @@ namespace Marvel{
 			for (mvAppItem* child : m_children)
 			{
 
-				if (child->m_name == before)
+				if (child->m_id == before)
 				{
 					beforeFound = true;
 					break;
@@ -264,7 +187,7 @@ namespace Marvel{
 
 				for (auto child : oldchildren)
 				{
-					if (child->m_name == before)
+					if (child->m_id == before)
 						m_children.push_back(item);
 					m_children.push_back(child);
 
@@ -288,105 +211,6 @@ namespace Marvel{
 		return false;
 	}
 
-	bool mvAppItem::addChildAfter(const std::string& prev, mvAppItem* item)
-	{
-		if (prev.empty())
-			return false;
-
-
-		bool prevFound = false;
-
-		// check children
-		for (mvAppItem* child : m_children)
-		{
-
-			if (child->m_name == prev)
-			{
-				item->m_parent = this;
-				prevFound = true;
-				break;
-			}
-
-		}
-
-		// prev item is in this container
-		if (prevFound)
-		{
-			//item->setParent(this);
-
-			std::vector<mvAppItem*> oldchildren = m_children;
-			m_children.clear();
-
-			for (auto child : oldchildren)
-			{
-				m_children.push_back(child);
-				if (child->m_name == prev)
-					m_children.push_back(item);
-			}
-
-			return true;
-		}
-		
-
-		// check children
-		for (mvAppItem* child : m_children)
-		{
-			if (child->getDescription().container)
-			{
-				// parent found
-				if (child->addChildAfter(prev, item))
-					return true;
-			}
-		}
-
-		return false;
-	}
-
-	bool mvAppItem::deleteChild(const std::string& name)
-	{
-
-		bool childfound = false;
-		bool itemDeleted = false;
-
-		for (mvAppItem* item : m_children)
-		{
-			if (item->m_name == name)
-			{
-				childfound = true;
-				break;
-			}
-
-			if (item->getDescription().container)
-			{
-				itemDeleted = item->deleteChild(name);
-				if (itemDeleted)
-					break;
-			}
-		}
-
-		if (childfound)
-		{
-			std::vector<mvAppItem*> oldchildren = m_children;
-
-			m_children.clear();
-
-			for (auto& item : oldchildren)
-			{
-				if (item->m_name == name)
-				{
-					delete item;
-					item = nullptr;
-					itemDeleted = true;
-					continue;
-				}
-
-				m_children.push_back(item);
-			}
-		}
-
-		return itemDeleted;
-	}
-
 	void mvAppItem::deleteChildren()
 	{
 		for (auto& child : m_children)
@@ -403,54 +227,11 @@ namespace Marvel{
 		m_label = value + "##" + m_name;
 	}
 
-	mvAppItem* mvAppItem::stealChild(const std::string& name)
+	mvAppItem* mvAppItem::getChild(mvIdentifier name)
 	{
-		mvAppItem* stolenChild = nullptr;
-
-		bool childfound = false;
-
 		for (mvAppItem* item : m_children)
 		{
-			if (item->m_name == name)
-			{
-				childfound = true;
-				break;
-			}
-
-			if (item->getDescription().container)
-			{
-				stolenChild = item->stealChild(name);
-				if (stolenChild)
-					return stolenChild;
-			}
-		}
-
-		if (childfound)
-		{
-			std::vector<mvAppItem*> oldchildren = m_children;
-
-			m_children.clear();
-
-			for (auto& item : oldchildren)
-			{
-				if (item->m_name == name)
-				{
-					stolenChild = item;
-					continue;
-				}
-
-				m_children.push_back(item);
-			}
-		}
-
-		return stolenChild;
-	}
-
-	mvAppItem* mvAppItem::getChild(const std::string& name)
-	{
-		for (mvAppItem* item : m_children)
-		{
-			if (item->m_name == name)
+			if (item->m_id == name)
 				return item;
 
 			if (item->getDescription().container)
@@ -467,6 +248,11 @@ namespace Marvel{
 	mvAppItem::~mvAppItem()
 	{
 		deleteChildren();
+		mvIdentifier::Release(m_id);
+
+		// most items have no callback, skip the lock for them
+		if (m_callback == nullptr && m_callbackData == nullptr)
+			return;
 
 		mvGlobalIntepreterLock gil;
 
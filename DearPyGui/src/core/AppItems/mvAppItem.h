@@ -18,6 +18,8 @@
 #include "mvAppItemDescription.h"
 #include "mvAppItemStyleManager.h"
 #include "mvCallbackRegistry.h"
+#include "mvItemPool.h"
+#include "mvIdentifier.h"
 
 //-----------------------------------------------------------------------------
 // Helper Macro
@@ -95,6 +97,11 @@ namespace Marvel {
 
         virtual ~mvAppItem();
 
+        // items come from mvItemPool (sized delete sees the most
+        // derived size through the virtual destructor)
+        static void* operator new   (size_t size) { return mvItemPool::Allocate(size); }
+        static void  operator delete(void* ptr, size_t size) { mvItemPool::Deallocate(ptr, size); }
+
         mvAppItem(const mvAppItem& other) = delete; // copy constructor
         mvAppItem(mvAppItem&& other)      = delete; // move constructor
 
@@ -135,18 +142,13 @@ namespace Marvel {
 
     private:
 
-        mvAppItem*                          getChild(const std::string& name);      // will return nullptr if not found
+        mvAppItem*                          getChild(mvIdentifier name);      // will return nullptr if not found
 
         // runtime modifications
-        bool                                addRuntimeChild(const std::string& parent, const std::string& before, mvAppItem* item);
-        bool                                addChildAfter(const std::string& prev, mvAppItem* item);
-        bool                                deleteChild(const std::string& name);
+        bool                                addRuntimeChild(mvIdentifier parent, mvIdentifier before, mvAppItem* item);
         void                                deleteChildren();
-        bool                                moveChildUp(const std::string& name);
-        bool                                moveChildDown(const std::string& name);
         void                                resetState();
         void                                registerWindowFocusing(); // only useful for imgui window types
-        mvAppItem*                          stealChild(const std::string& name); // steals a child (used for moving)
 
 
 
@@ -161,6 +163,7 @@ namespace Marvel {
 
         std::string             m_dataSource;
         std::string             m_name;
+        mvIdentifier            m_id; // interned m_name, used for lookups
         std::string             m_label;
         std::string             m_popup;
         std::string             m_tip;
@@ -0,0 +1,116 @@
+#include "mvItemPool.h"
+#include <new>
+#include "mvMemory.h"
+
+namespace Marvel {
+
+	std::mutex            mvItemPool::s_mutex;
+	mvItemPool::SizeClass mvItemPool::s_classes[mvItemPool::ClassCount];
+	size_t                mvItemPool::s_reserved = 0;
+	size_t                mvItemPool::s_liveBytes = 0;
+
+	static size_t ClassIndex(size_t size)
+	{
+		return (size + mvItemPool::Granularity - 1) / mvItemPool::Granularity - 1;
+	}
+
+	void* mvItemPool::Allocate(size_t size)
+	{
+		mvMemory::Record(mvMemoryCategory::Items, size);
+
+		if (size == 0 || size > MaxPooledSize)
+			return ::operator new(size);
+
+		size_t index = ClassIndex(size);
+		size_t slotSize = (index + 1) * Granularity;
+
+		std::lock_guard<std::mutex> lock(s_mutex);
+
+		SizeClass& sizeClass = s_classes[index];
+		sizeClass.live++;
+		s_liveBytes += slotSize;
+
+		if (sizeClass.freeList)
+		{
+			FreeSlot* slot = sizeClass.freeList;
+			sizeClass.freeList = slot->next;
+			return slot;
+		}
+
+		if (sizeClass.bump == sizeClass.bumpEnd)
+		{
+			size_t slots = ChunkSize / slotSize > 0 ? ChunkSize / slotSize : 1;
+			size_t chunkSize = slots * slotSize;
+
+			char* chunk = static_cast<char*>(::operator new(chunkSize));
+			sizeClass.chunks.push_back(chunk);
+			sizeClass.bump = chunk;
+			sizeClass.bumpEnd = chunk + chunkSize;
+			s_reserved += chunkSize;
+		}
+
+		void* ptr = sizeClass.bump;
+		sizeClass.bump += slotSize;
+		return ptr;
+	}
+
+	void mvItemPool::Deallocate(void* ptr, size_t size)
+	{
+		if (ptr == nullptr)
+			return;
+
+		mvMemory::Release(mvMemoryCategory::Items, size);
+
+		if (size == 0 || size > MaxPooledSize)
+		{
+			::operator delete(ptr);
+			return;
+		}
+
+		size_t index = ClassIndex(size);
+
+		std::lock_guard<std::mutex> lock(s_mutex);
+
+		SizeClass& sizeClass = s_classes[index];
+		sizeClass.live--;
+		s_liveBytes -= (index + 1) * Granularity;
+
+		FreeSlot* slot = static_cast<FreeSlot*>(ptr);
+		slot->next = sizeClass.freeList;
+		sizeClass.freeList = slot;
+	}
+
+	void mvItemPool::Trim()
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+
+		for (size_t i = 0; i < ClassCount; i++)
+		{
+			SizeClass& sizeClass = s_classes[i];
+			if (sizeClass.live > 0 || sizeClass.chunks.empty())
+				continue;
+
+			size_t slotSize = (i + 1) * Granularity;
+			size_t slots = ChunkSize / slotSize > 0 ? ChunkSize / slotSize : 1;
+
+			for (char* chunk : sizeClass.chunks)
+				::operator delete(chunk);
+
+			s_reserved -= sizeClass.chunks.size() * slots * slotSize;
+			sizeClass = SizeClass();
+		}
+	}
+
+	size_t mvItemPool::GetReservedBytes()
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+		return s_reserved;
+	}
+
+	size_t mvItemPool::GetIdleBytes()
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+		return s_reserved - s_liveBytes;
+	}
+
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// mvItemPool
+//
+//     - Backs operator new/delete for app items. Items are carved out of
+//       64 KB chunks grouped by size class, and deleted items go back on
+//       their class' free list instead of to the heap, so building and
+//       tearing down large trees doesn't go through malloc per item.
+//
+//     - Chunks are kept after a window is deleted so the next tree reuses
+//       them. Trim returns chunks of size classes with no live items and
+//       is called when the registry is cleared.
+//
+//     - Items larger than MaxPooledSize use the heap directly.
+//
+//-----------------------------------------------------------------------------
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace Marvel {
+
+	class mvItemPool
+	{
+
+	public:
+
+		static constexpr size_t Granularity   = 16;
+		static constexpr size_t MaxPooledSize = 4096;
+		static constexpr size_t ChunkSize     = 64 * 1024;
+
+	public:
+
+		static void*  Allocate    (size_t size);
+		static void   Deallocate  (void* ptr, size_t size);
+		static void   Trim        ();
+
+		static size_t GetReservedBytes();
+		static size_t GetIdleBytes    (); // reserved but not holding a live item
+
+	private:
+
+		struct FreeSlot
+		{
+			FreeSlot* next;
+		};
+
+		struct SizeClass
+		{
+			FreeSlot*          freeList = nullptr;
+			char*              bump     = nullptr; // unused tail of the newest chunk
+			char*              bumpEnd  = nullptr;
+			std::vector<char*> chunks;
+			size_t             live     = 0;
+		};
+
+		static constexpr size_t ClassCount = MaxPooledSize / Granularity;
+
+		static std::mutex s_mutex;
+		static SizeClass  s_classes[ClassCount];
+		static size_t     s_reserved;
+		static size_t     s_liveBytes;
+
+	};
+
+}
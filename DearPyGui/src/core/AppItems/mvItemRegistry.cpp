@@ -1,9 +1,13 @@
 #include "mvItemRegistry.h"
 #include "mvPythonExceptions.h"
 #include "mvProfiler.h"
+#include "mvCostTracker.h"
 #include "mvApp.h"
 #include "mvItemRegistry.h"
 #include "mvAppItems.h"
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace Marvel {
 
@@ -55,9 +59,15 @@ namespace Marvel {
 
 		// resets app items states (i.e. hovered)
 		for (auto window : m_frontWindows)
+		{
+			mvCostScope cost(window->m_name);
 			window->draw();
+		}
 		for (auto window : m_backWindows)
+		{
+			mvCostScope cost(window->m_name);
 			window->draw();
+		}
 
 		return false;
 	}
@@ -82,9 +92,13 @@ namespace Marvel {
 		mvApp::GetApp()->getItemRegistry().postAddItems();
 		mvApp::GetApp()->getItemRegistry().postAddPopups();
 		mvApp::GetApp()->getItemRegistry().postMoveItems();
+		mvApp::GetApp()->getItemRegistry().resetIndex();
 
 		Py_END_ALLOW_THREADS
 
+		// queued operations hold names no item retains, keep them until applied
+		mvApp::GetApp()->getItemRegistry().compactNames();
+
 		return false;
 	}
 
@@ -99,9 +113,9 @@ namespace Marvel {
 	bool mvItemRegistry::onDeleteItem(mvEvent& event)
 	{
 		if (GetEBool(event, "CHILDREN_ONLY"))
-			m_deleteChildrenQueue.push(GetEString(event, "ITEM"));
+			m_deleteChildrenQueue.push(mvIdentifier(GetEString(event, "ITEM")));
 		else
-			m_deleteQueue.push_back(GetEString(event, "ITEM"));
+			m_deleteQueue.insert(mvIdentifier(GetEString(event, "ITEM")));
 
 		return true;
 	}
@@ -109,25 +123,30 @@ namespace Marvel {
 	bool mvItemRegistry::onMoveItem(mvEvent& event)
 	{
 		m_moveVec.push({ 
-			GetEString(event, "ITEM"), 
-			GetEString(event, "PARENT"), 
-			GetEString(event, "BEFORE") });
+			mvIdentifier(GetEString(event, "ITEM")), 
+			mvIdentifier(GetEString(event, "PARENT")), 
+			mvIdentifier(GetEString(event, "BEFORE")) });
 		return true;
 	}
 
 	bool mvItemRegistry::onMoveItemUp(mvEvent& event)
 	{
-		m_upQueue.push(GetEString(event, "ITEM"));
+		m_upQueue.push(mvIdentifier(GetEString(event, "ITEM")));
 		return true;
 	}
 
 	bool mvItemRegistry::onMoveItemDown(mvEvent& event)
 	{
-		m_downQueue.push(GetEString(event, "ITEM"));
+		m_downQueue.push(mvIdentifier(GetEString(event, "ITEM")));
 		return true;
 	}
 
 	bool mvItemRegistry::addRuntimeItem(const std::string& parent, const std::string& before, mvAppItem* item)
+	{
+		return addRuntimeItem(mvIdentifier(parent), mvIdentifier(before), item);
+	}
+
+	bool mvItemRegistry::addRuntimeItem(mvIdentifier parent, mvIdentifier before, mvAppItem* item)
 	{
 		if (!mvApp::GetApp()->checkIfMainThread())
 			return false;
@@ -142,12 +161,16 @@ namespace Marvel {
 		if (!mvApp::GetApp()->checkIfMainThread())
 			return false;
 
-		m_orderedVec.push_back({ item, prev });
+		m_orderedVec.push_back({ item, mvIdentifier(prev) });
 		return true;
 	}
 
 	void mvItemRegistry::pushParent(mvAppItem* item)
 	{
+		// batch items name their parents
+		if (m_batching)
+			return;
+
 		m_parents.push(item);
 	}
 
@@ -186,19 +209,29 @@ namespace Marvel {
 	}
 
 	mvAppItem* mvItemRegistry::getItemAsync(const std::string& name, bool ignoreRuntime)
+	{
+		// names that were never interned can't belong to an item
+		mvIdentifier id = mvIdentifier::Find(name);
+		if (id.empty())
+			return nullptr;
+
+		return findItem(id, ignoreRuntime);
+	}
+
+	mvAppItem* mvItemRegistry::findItem(mvIdentifier name, bool ignoreRuntime)
 	{
 
 		mvAppItem* item = nullptr;
 
 		if (!ignoreRuntime)
-			item = getRuntimeItem(name);
+			item = findRuntimeItem(name);
 
 		if (item)
 			return item;
 
 		for (auto window : m_frontWindows)
 		{
-			if (window->m_name == name)
+			if (window->m_id == name)
 				return window;
 
 			auto child = window->getChild(name);
@@ -208,7 +241,7 @@ namespace Marvel {
 
 		for (auto window : m_backWindows)
 		{
-			if (window->m_name == name)
+			if (window->m_id == name)
 				return window;
 
 			auto child = window->getChild(name);
@@ -220,22 +253,40 @@ namespace Marvel {
 	}
 
 	mvAppItem* mvItemRegistry::getRuntimeItem(const std::string& name)
+	{
+		mvIdentifier id = mvIdentifier::Find(name);
+		if (id.empty())
+			return nullptr;
+
+		return findRuntimeItem(id);
+	}
+
+	mvAppItem* mvItemRegistry::findRuntimeItem(mvIdentifier name)
 	{
 
 		for (auto& item : m_newItemVec)
 		{
 
-			if (item.item->m_name == name)
+			if (item.item->m_id == name)
 				return item.item;
 		}
 
 		for (auto& item : m_orderedVec)
 		{
 
-			if (item.item->m_name == name)
+			if (item.item->m_id == name)
 				return item.item;
 		}
 
+		for (auto& batch : m_newBatchVec)
+		{
+			for (mvAppItem* item : batch.items)
+			{
+				if (item->m_id == name)
+					return item;
+			}
+		}
+
 		return nullptr;
 	}
 
@@ -258,13 +309,11 @@ namespace Marvel {
 
 	bool mvItemRegistry::isItemToBeDeleted(const std::string& name) const
 	{
-		for (const auto& item : m_deleteQueue)
-		{
-			if (name == item)
-				return true;
-		}
+		mvIdentifier id = mvIdentifier::Find(name);
+		if (id.empty())
+			return false;
 
-		return false;
+		return m_deleteQueue.count(id) != 0;
 	}
 
 	bool mvItemRegistry::addItem(mvAppItem* item)
@@ -277,7 +326,7 @@ namespace Marvel {
 
 		if (!item->getDescription().duplicatesAllowed)
 		{
-			if (getItem(item->m_name))
+			if (findItem(item->m_id))
 			{
 				std::string message = item->m_name + " " + std::to_string(count);
 				ThrowPythonException(message + ": Items of this type must have unique names");
@@ -312,251 +361,493 @@ namespace Marvel {
 		return true;
 	}
 
-	void mvItemRegistry::postDeleteItems()
+	mvAppItem* mvItemRegistry::lookupItem(mvIdentifier name)
 	{
-		MV_PROFILE_FUNCTION()
-
-			// delete items from the delete queue
-			while (!m_deleteChildrenQueue.empty())
+		if (!m_indexBuilt)
+		{
+			if (m_indexLookups < IndexThreshold)
 			{
-				auto item = getItem(m_deleteChildrenQueue.front());
-				if (item)
-					item->deleteChildren();
-				m_deleteChildrenQueue.pop();
+				m_indexLookups++;
+				return findItem(name, true);
 			}
 
-		// delete items from the delete queue
-		for(auto& item : m_deleteQueue)
+			buildIndex();
+		}
+
+		auto found = m_index.find(name);
+		if (found == m_index.end())
+			return nullptr;
+		return found->second;
+	}
+
+	mvAppItem* mvItemRegistry::findInsertPosition(mvIdentifier parent, mvIdentifier before, std::vector<mvAppItem*>::iterator& position)
+	{
+		// before takes precedence over parent
+		if (!before.empty())
 		{
-			bool deletedItem = false;
+			mvAppItem* sibling = lookupItem(before);
+			if (sibling == nullptr || sibling->m_parent == nullptr)
+				return nullptr;
+
+			auto& children = sibling->m_parent->m_children;
+			position = std::find(children.begin(), children.end(), sibling);
+			return sibling->m_parent;
+		}
+
+		if (parent.empty())
+			return nullptr;
+
+		mvAppItem* container = lookupItem(parent);
+		if (container == nullptr || !(container->getDescription().container || container->getDescription().root))
+			return nullptr;
 
-			// try to delete item
-			for (auto window : m_frontWindows)
+		position = container->m_children.end();
+		return container;
+	}
+
+	void mvItemRegistry::buildIndex()
+	{
+		MV_PROFILE_FUNCTION()
+
+		m_index.clear();
+		m_indexBuilt = true;
+
+		// same order as findItem so the first of duplicate names wins
+		for (auto window : m_frontWindows)
+			indexItem(window);
+		for (auto window : m_backWindows)
+			indexItem(window);
+	}
+
+	void mvItemRegistry::indexItem(mvAppItem* item)
+	{
+		if (!m_indexBuilt)
+			return;
+
+		m_index.emplace(item->m_id, item);
+
+		if (item->getDescription().container || item->getDescription().root)
+		{
+			for (mvAppItem* child : item->m_children)
+				indexItem(child);
+		}
+	}
+
+	void mvItemRegistry::unindexItem(mvAppItem* item)
+	{
+		if (!m_indexBuilt)
+			return;
+
+		auto found = m_index.find(item->m_id);
+		if (found != m_index.end() && found->second == item)
+		{
+			m_index.erase(found);
+
+			// another item may share the name, find it again
+			if (item->getDescription().duplicatesAllowed)
 			{
-				deletedItem = window->deleteChild(item);
-				if (deletedItem)
-					break;
+				m_index.clear();
+				m_indexBuilt = false;
+				return;
 			}
+		}
+
+		for (mvAppItem* child : item->m_children)
+			unindexItem(child);
+	}
+
+	void mvItemRegistry::resetIndex()
+	{
+		m_index.clear();
+		m_indexBuilt = false;
+		m_indexLookups = 0;
+	}
+
+	void mvItemRegistry::postDeleteItems()
+	{
+		MV_PROFILE_FUNCTION()
 
-			if (!deletedItem)
+		// delete items from the delete queue
+		while (!m_deleteChildrenQueue.empty())
+		{
+			auto item = lookupItem(m_deleteChildrenQueue.front());
+			if (item)
 			{
-				for (auto window : m_backWindows)
-				{
-					deletedItem = window->deleteChild(item);
-					if (deletedItem)
-						break;
-				}
+				for (mvAppItem* child : item->m_children)
+					unindexItem(child);
+				item->deleteChildren();
 			}
+			m_deleteChildrenQueue.pop();
+		}
 
-			bool frontWindowDeleting = false;
-			bool backWindowDeleting = false;
+		if (m_deleteQueue.empty())
+			return;
 
-			// check if attempting to delete a window
-			for (auto window : m_frontWindows)
+		// mark items first so each parent's children are compacted once
+		std::unordered_set<mvAppItem*> marked;
+		marked.reserve(m_deleteQueue.size());
+
+		for (auto& name : m_deleteQueue)
+		{
+			mvAppItem* item = lookupItem(name);
+			if (item)
+				marked.insert(item);
+			else
+				ThrowPythonException(name.getString() + " not deleted because it was not found");
+		}
+		m_deleteQueue.clear();
+
+		std::unordered_set<mvAppItem*> parents;
+		bool windows = false;
+
+		for (mvAppItem* item : marked)
+		{
+			// deleted along with a marked ancestor
+			bool ancestorMarked = false;
+			for (mvAppItem* ancestor = item->m_parent; ancestor; ancestor = ancestor->m_parent)
 			{
-				if (window->m_name == item)
+				if (marked.count(ancestor))
 				{
-					frontWindowDeleting = true;
+					ancestorMarked = true;
 					break;
 				}
 			}
 
-			for (auto window : m_backWindows)
+			if (ancestorMarked)
+				continue;
+
+			if (item->m_parent)
+				parents.insert(item->m_parent);
+			else
+				windows = true;
+
+			unindexItem(item);
+		}
+
+		auto compact = [&marked](std::vector<mvAppItem*>& items) {
+			auto isMarked = [&marked](mvAppItem* item) {
+				if (marked.count(item) == 0)
+					return false;
+				delete item;
+				return true;
+			};
+			items.erase(std::remove_if(items.begin(), items.end(), isMarked), items.end());
+		};
+
+		for (mvAppItem* parent : parents)
+			compact(parent->m_children);
+
+		if (windows)
+		{
+			compact(m_frontWindows);
+			compact(m_backWindows);
+		}
+	}
+
+	void mvItemRegistry::postAddItems()
+	{
+		MV_PROFILE_FUNCTION()
+
+		// batches are attached in submission order so later
+		// runtime items can target items created by add_items
+		size_t nextBatch = 0;
+
+		// add runtime items
+		for (size_t i = 0; i < m_newItemVec.size(); i++)
+		{
+			while (nextBatch < m_newBatchVec.size() && m_newBatchVec[nextBatch].queued <= i)
+				postAddBatch(m_newBatchVec[nextBatch++]);
+
+			NewRuntimeItem& newItem = m_newItemVec[i];
+
+			if (!newItem.item->getDescription().duplicatesAllowed)
 			{
-				if (window->m_name == item)
+				if (lookupItem(newItem.item->m_id))
 				{
-					backWindowDeleting = true;
-					break;
+					std::string message = newItem.item->m_name;
+					ThrowPythonException(message + ": Items of this type must have unique names");
+					delete newItem.item;
+					newItem.item = nullptr;
+					continue;
 				}
 			}
 
-			// delete window and update window vector
-			// this should be changed to a different data
-			// structure
-			if (frontWindowDeleting)
+			if (newItem.item->getDescription().root)
 			{
-				std::vector<mvAppItem*> oldwindows = m_frontWindows;
+				m_frontWindows.push_back(newItem.item);
+				indexItem(newItem.item);
+				continue;
+			}
 
-				m_frontWindows.clear();
+			std::vector<mvAppItem*>::iterator position;
+			mvAppItem* parent = findInsertPosition(newItem.parent, newItem.before, position);
+			if (parent)
+			{
+				newItem.item->m_parent = parent;
+				parent->m_children.insert(position, newItem.item);
+				indexItem(newItem.item);
+				continue;
+			}
 
-				for (auto window : oldwindows)
-				{
-					if (window->m_name == item)
-					{
-						delete window;
-						window = nullptr;
-						deletedItem = true;
-						continue;
-					}
-					m_frontWindows.push_back(window);
-				}
+			// popups are attached after runtime items
+			bool addedItem = false;
+			for (auto otherItems : m_orderedVec)
+			{
+				addedItem = otherItems.item->addRuntimeChild(newItem.parent, newItem.before, newItem.item);
+				if (addedItem)
+					break;
 			}
 
-			if (backWindowDeleting)
+			if (!addedItem)
 			{
-				std::vector<mvAppItem*> oldwindows = m_backWindows;
+				ThrowPythonException(newItem.item->m_name + " not added because its parent was not found");
+				delete newItem.item;
+				newItem.item = nullptr;
+			}
 
-				m_backWindows.clear();
+		}
 
-				for (auto window : oldwindows)
-				{
-					if (window->m_name == item)
-					{
-						delete window;
-						window = nullptr;
-						deletedItem = true;
-						continue;
-					}
-					m_backWindows.push_back(window);
-				}
-			}
+		while (nextBatch < m_newBatchVec.size())
+			postAddBatch(m_newBatchVec[nextBatch++]);
 
-			if (!deletedItem)
-				ThrowPythonException(item + " not deleted because it was not found");
+		m_newItemVec.clear();
+		m_newBatchVec.clear();
+	}
 
-			
+	void mvItemRegistry::postAddBatch(NewBatch& batch)
+	{
+		MV_PROFILE_FUNCTION()
+
+		// consecutive roots with the same target share one lookup
+		size_t first = 0;
+		while (first < batch.roots.size())
+		{
+			size_t last = first + 1;
+			while (last < batch.roots.size() 
+				&& batch.roots[last].parent == batch.roots[first].parent 
+				&& batch.roots[last].before == batch.roots[first].before)
+				last++;
+
+			attachBatchRoots(&batch.roots[first], &batch.roots[last - 1] + 1);
+			first = last;
 		}
-		m_deleteQueue.clear();
 	}
 
-	void mvItemRegistry::postAddItems()
+	void mvItemRegistry::attachBatchRoots(NewRuntimeItem* first, NewRuntimeItem* last)
 	{
-		MV_PROFILE_FUNCTION()
+		std::vector<mvAppItem*>::iterator position;
+		mvAppItem* parent = findInsertPosition(first->parent, first->before, position);
 
-			// add runtime items
-			for (auto& newItem : m_newItemVec)
+		std::vector<mvAppItem*> items;
+		items.reserve(last - first);
+		for (NewRuntimeItem* root = first; root != last; root++)
+		{
+			// windows ignore their target
+			if (root->item->getDescription().root)
 			{
+				m_frontWindows.push_back(root->item);
+				indexItem(root->item);
+				continue;
+			}
 
+			if (parent == nullptr)
+			{
+				// popups are attached after runtime items
 				bool addedItem = false;
-
-				if (!newItem.item->getDescription().duplicatesAllowed)
+				for (auto otherItems : m_orderedVec)
 				{
-					if (getItem(newItem.item->m_name, true))
-					{
-						std::string message = newItem.item->m_name;
-						ThrowPythonException(message + ": Items of this type must have unique names");
-						delete newItem.item;
-						newItem.item = nullptr;
-						continue;
-					}
-				}
-
-				if (newItem.item->getDescription().root)
-				{
-					m_frontWindows.push_back(newItem.item);
-					continue;
-				}
-
-				for (auto window : m_frontWindows)
-				{
-					addedItem = window->addRuntimeChild(newItem.parent, newItem.before, newItem.item);
+					addedItem = otherItems.item->addRuntimeChild(root->parent, root->before, root->item);
 					if (addedItem)
 						break;
 				}
 
 				if (!addedItem)
 				{
-					for (auto otherItems : m_orderedVec)
-					{
-						addedItem = otherItems.item->addRuntimeChild(newItem.parent, newItem.before, newItem.item);
-						if (addedItem)
-							break;
-					}
+					ThrowPythonException(root->item->m_name + " not added because its parent was not found");
+					delete root->item;
 				}
+				continue;
+			}
 
-				if (!addedItem)
-				{
-					ThrowPythonException(newItem.item->m_name + " not added because its parent was not found");
-					delete newItem.item;
-					newItem.item = nullptr;
-				}
+			root->item->m_parent = parent;
+			items.push_back(root->item);
+		}
 
-			}
+		if (parent && !items.empty())
+		{
+			parent->m_children.insert(position, items.begin(), items.end());
+			for (mvAppItem* item : items)
+				indexItem(item);
+		}
+	}
 
-		m_newItemVec.clear();
+	void mvItemRegistry::beginBatch()
+	{
+		m_batching = true;
+		m_batchItems.clear();
 	}
 
-	void mvItemRegistry::postAddPopups()
+	bool mvItemRegistry::endBatch()
 	{
-		MV_PROFILE_FUNCTION()
+		m_batching = false;
+
+		std::vector<NewRuntimeItem> items;
+		items.swap(m_batchItems);
+
+		if (items.empty())
+			return false;
+
+		// names already in use, one walk instead of a lookup per item
+		std::unordered_set<mvIdentifier> existing;
+		std::function<void(mvAppItem*)> collect = [&](mvAppItem* item) {
+			existing.insert(item->m_id);
+			for (mvAppItem* child : item->m_children)
+				collect(child);
+		};
 
-			// add popup items
-			for (auto& popup : m_orderedVec)
+		for (auto window : m_frontWindows)
+			collect(window);
+		for (auto window : m_backWindows)
+			collect(window);
+		for (auto& item : m_newItemVec)
+			collect(item.item);
+		for (auto& item : m_orderedVec)
+			collect(item.item);
+		for (auto& batch : m_newBatchVec)
+		{
+			for (mvAppItem* item : batch.items)
+				existing.insert(item->m_id);
+		}
+
+		std::unordered_map<mvIdentifier, mvAppItem*> index;
+		index.reserve(items.size());
+
+		for (auto& newItem : items)
+		{
+			mvAppItem* item = newItem.item;
+			if (!item->getDescription().duplicatesAllowed && (existing.count(item->m_id) || index.count(item->m_id)))
 			{
+				ThrowPythonException(item->m_name + ": Items of this type must have unique names");
+				for (auto& unused : items)
+					delete unused.item;
+				return false;
+			}
 
-				bool addedItem = false;
+			index.emplace(item->m_id, item);
+		}
+
+		NewBatch batch;
+		batch.items.reserve(items.size());
+		batch.queued = m_newItemVec.size();
+
+		// link items to parents within the batch, the rest are attached later
+		for (auto& newItem : items)
+		{
+			mvAppItem* item = newItem.item;
+			batch.items.push_back(item);
 
-				if (getItem(popup.item->m_name, true))
+			if (newItem.before.empty())
+			{
+				auto parent = index.find(newItem.parent);
+				if (parent != index.end() && parent->second->getDescription().container && !item->getDescription().root)
 				{
-					std::string message = popup.item->m_name;
-					ThrowPythonException(message + ": Items of this type must have unique names");
-					delete popup.item;
-					popup.item = nullptr;
+					item->m_parent = parent->second;
+					parent->second->m_children.push_back(item);
 					continue;
 				}
-
-				for (auto window : m_frontWindows)
+			}
+			else
+			{
+				// the sibling must come earlier in the batch
+				auto sibling = index.find(newItem.before);
+				if (sibling != index.end() && sibling->second->m_parent)
 				{
-					addedItem = window->addChildAfter(popup.prev, popup.item);
-					if (addedItem)
-						break;
+					auto& children = sibling->second->m_parent->m_children;
+					item->m_parent = sibling->second->m_parent;
+					children.insert(std::find(children.begin(), children.end(), sibling->second), item);
+					continue;
 				}
+			}
 
-				if (!addedItem)
-				{
-					ThrowPythonException(popup.item->m_name + " not added because its parent was not found");
-					delete popup.item;
-					popup.item = nullptr;
-				}
+			batch.roots.push_back(newItem);
+		}
 
-			}
-		m_orderedVec.clear();
+		m_newBatchVec.push_back(std::move(batch));
+		return true;
 	}
 
-	void mvItemRegistry::postMoveItems()
+	void mvItemRegistry::postAddPopups()
 	{
 		MV_PROFILE_FUNCTION()
 
-			// move
-			while (!m_moveVec.empty())
+		// add popup items
+		for (auto& popup : m_orderedVec)
+		{
+
+			if (lookupItem(popup.item->m_id))
 			{
-				StolenChild childrequest = m_moveVec.front();
-				m_moveVec.pop();
+				std::string message = popup.item->m_name;
+				ThrowPythonException(message + ": Items of this type must have unique names");
+				delete popup.item;
+				popup.item = nullptr;
+				continue;
+			}
 
-				mvAppItem* child = nullptr;
+			mvAppItem* prev = lookupItem(popup.prev);
+			if (prev == nullptr || prev->m_parent == nullptr)
+			{
+				ThrowPythonException(popup.item->m_name + " not added because its parent was not found");
+				delete popup.item;
+				popup.item = nullptr;
+				continue;
+			}
 
-				bool movedItem = false;
+			auto& children = prev->m_parent->m_children;
+			children.insert(std::find(children.begin(), children.end(), prev) + 1, popup.item);
+			popup.item->m_parent = prev->m_parent;
+			indexItem(popup.item);
 
-				for (auto window : m_frontWindows)
-				{
-					child = window->stealChild(childrequest.item);
-					if (child)
-						break;
-				}
+		}
+		m_orderedVec.clear();
+	}
 
-				if (child == nullptr)
-					ThrowPythonException(childrequest.item + " not moved because it was not found");
+	void mvItemRegistry::postMoveItems()
+	{
+		MV_PROFILE_FUNCTION()
 
-				if (child)
-					addRuntimeItem(childrequest.parent, childrequest.before, child);
+		// move
+		while (!m_moveVec.empty())
+		{
+			StolenChild childrequest = m_moveVec.front();
+			m_moveVec.pop();
+
+			mvAppItem* child = lookupItem(childrequest.item);
+			if (child == nullptr || child->m_parent == nullptr)
+			{
+				ThrowPythonException(childrequest.item.getString() + " not moved because it was not found");
+				continue;
 			}
 
+			auto& siblings = child->m_parent->m_children;
+			siblings.erase(std::find(siblings.begin(), siblings.end(), child));
+			unindexItem(child);
+
+			addRuntimeItem(childrequest.parent, childrequest.before, child);
+		}
+
 		// move items up
 		while (!m_upQueue.empty())
 		{
-			std::string& itemname = m_upQueue.front();
-
-			bool movedItem = false;
-
-			for (auto window : m_frontWindows)
+			mvAppItem* item = lookupItem(m_upQueue.front());
+			if (item && item->m_parent)
 			{
-				movedItem = window->moveChildUp(itemname);
-				if (movedItem)
-					break;
+				auto& siblings = item->m_parent->m_children;
+				auto position = std::find(siblings.begin(), siblings.end(), item);
+				if (position != siblings.begin())
+					std::iter_swap(position, position - 1);
 			}
-
-			if (!movedItem)
-				ThrowPythonException(itemname + " not moved because it was not found");
+			else
+				ThrowPythonException(m_upQueue.front().getString() + " not moved because it was not found");
 
 			m_upQueue.pop();
 		}
@@ -564,19 +855,16 @@ namespace Marvel {
 		// move items down
 		while (!m_downQueue.empty())
 		{
-			std::string& itemname = m_downQueue.front();
-
-			bool movedItem = false;
-
-			for (auto window : m_frontWindows)
+			mvAppItem* item = lookupItem(m_downQueue.front());
+			if (item && item->m_parent)
 			{
-				movedItem = window->moveChildDown(itemname);
-				if (movedItem)
-					break;
+				auto& siblings = item->m_parent->m_children;
+				auto position = std::find(siblings.begin(), siblings.end(), item);
+				if (position + 1 != siblings.end())
+					std::iter_swap(position, position + 1);
 			}
-
-			if (!movedItem)
-				ThrowPythonException(itemname + " not moved because it was not found");
+			else
+				ThrowPythonException(m_downQueue.front().getString() + " not moved because it was not found");
 
 			m_downQueue.pop();
 		}
@@ -597,6 +885,20 @@ namespace Marvel {
 			window = nullptr;
 		}
 		m_backWindows.clear();
+
+		// nothing left to reuse the pooled slots
+		mvItemPool::Trim();
+		compactNames();
+	}
+
+	void mvItemRegistry::compactNames()
+	{
+		if (m_batching || !m_batchItems.empty() || !m_deleteChildrenQueue.empty() || !m_deleteQueue.empty()
+			|| !m_upQueue.empty() || !m_downQueue.empty() || !m_newItemVec.empty() || !m_orderedVec.empty()
+			|| !m_moveVec.empty() || !m_newBatchVec.empty())
+			return;
+
+		mvIdentifier::Compact();
 	}
 
 	bool mvItemRegistry::addItemWithRuntimeChecks(mvAppItem* item, const char* parent, const char* before)
@@ -605,6 +907,17 @@ namespace Marvel {
 		if (item == nullptr)
 			return false;
 
+		// collected for endBatch, popups and tooltips still follow their item
+		if (m_batching && item->getType() != mvAppItemType::Popup && item->getType() != mvAppItemType::Tooltip)
+		{
+			mvIdentifier parentId(parent);
+			if (parentId.empty() && std::string(before).empty() && !item->getDescription().root && topParent())
+				parentId = topParent()->m_id;
+
+			m_batchItems.push_back({ item, mvIdentifier(before), parentId });
+			return true;
+		}
+
 		// remove bad parent stack item
 		if (item->getDescription().root && topParent() != nullptr)
 		{
@@ -629,7 +942,7 @@ namespace Marvel {
 
 		// adding without specifying before or parent, instead using parent stack
 		else if (std::string(parent).empty() && std::string(before).empty() && mvApp::IsAppStarted() && topParent() != nullptr)
-			return addRuntimeItem(topParent()->m_name, before, item);
+			return addRuntimeItem(topParent()->m_id, mvIdentifier(before), item);
 
 		// adding without specifying before or parent, but with empty stack (add to main window)
 		else if (std::string(parent).empty() && std::string(before).empty() && mvApp::IsAppStarted())
@@ -4,7 +4,10 @@
 #include <vector>
 #include <queue>
 #include <string>
+#include <unordered_set>
 #include "mvEvents.h"
+#include "mvIdentifier.h"
+#include "mvMemory.h"
 
 namespace Marvel {
 
@@ -22,24 +25,33 @@ namespace Marvel {
 
         friend class mvApp;
 
+        // queued operations refer to items by interned name
         struct OrderedItem
         {
-            mvAppItem* item;   // new item to add
-            std::string prev;  // what item to add item after
+            mvAppItem*   item; // new item to add
+            mvIdentifier prev; // what item to add item after
         };
 
         struct NewRuntimeItem
         {
-            mvAppItem* item;    // new item to add
-            std::string before; // what item to add new item before
-            std::string parent; // what parent to add item to (if not using before)
+            mvAppItem*   item;   // new item to add
+            mvIdentifier before; // what item to add new item before
+            mvIdentifier parent; // what parent to add item to (if not using before)
         };
 
         struct StolenChild
         {
-            std::string item;   // item to steal
-            std::string parent; // what item to add stolen item before
-            std::string before; // what parent to add item to (if not using before)
+            mvIdentifier item;   // item to steal
+            mvIdentifier parent; // what parent to add item to (if not using before)
+            mvIdentifier before; // what item to add stolen item before
+        };
+
+        // subtree built by add_items, attached at the end of the frame
+        struct NewBatch
+        {
+            std::vector<NewRuntimeItem> roots; // items whose parent is outside the batch
+            std::vector<mvAppItem*>     items; // every item in the batch (for lookups)
+            size_t                      queued = 0; // runtime items submitted before the batch
         };
 
 	public:
@@ -76,6 +88,17 @@ namespace Marvel {
         std::vector<mvAppItem*>& getBackWindows    () { return m_backWindows; }
         const std::string&       getActiveWindow() const { return m_activeWindow; }
         bool                     addItemWithRuntimeChecks(mvAppItem* item, const char* parent, const char* before);
+
+        //-----------------------------------------------------------------------------
+        // Batched creation
+        //     - items added between begin and end are collected instead of queued,
+        //       linked to parents within the batch and attached at the end of the
+        //       frame with one parent lookup per target
+        //     - containers don't push the parent stack while batching
+        //-----------------------------------------------------------------------------
+        void                     beginBatch  ();
+        bool                     endBatch    (); // false if nothing was queued
+        bool                     isBatching  () const { return m_batching; }
         
         // called by python interface
         std::vector<std::string> getAllItems       ();
@@ -95,11 +118,31 @@ namespace Marvel {
 
     private:
 
+        mvAppItem*               findItem       (mvIdentifier name, bool ignoreRuntime = false);
+        mvAppItem*               findRuntimeItem(mvIdentifier name);
+        bool                     addRuntimeItem (mvIdentifier parent, mvIdentifier before, mvAppItem* item);
+
+        //-----------------------------------------------------------------------------
+        // End of frame name index
+        //     - the first few lookups of a frame walk the tree, after that the
+        //       index is built once and kept up to date as items are attached
+        //       and removed, it is dropped when the frame's operations are done
+        //-----------------------------------------------------------------------------
+        mvAppItem*               lookupItem        (mvIdentifier name);
+        mvAppItem*               findInsertPosition(mvIdentifier parent, mvIdentifier before, std::vector<mvAppItem*>::iterator& position);
+        void                     buildIndex        ();
+        void                     indexItem         (mvAppItem* item);   // item and its subtree
+        void                     unindexItem       (mvAppItem* item);   // item and its subtree
+        void                     resetIndex        ();
+
         void                     postDeleteItems();
         void                     postAddItems   ();
+        void                     postAddBatch   (NewBatch& batch);
+        void                     attachBatchRoots(NewRuntimeItem* first, NewRuntimeItem* last);
         void                     postAddPopups  ();
         void                     postMoveItems  ();
         void                     clearRegistry  ();
+        void                     compactNames   (); // releases unused interned names once nothing is queued
 
 	private:
 
@@ -109,13 +152,24 @@ namespace Marvel {
         std::string             m_activeWindow;
 
         // runtime widget modifications
-        std::queue<std::string>     m_deleteChildrenQueue;
-        std::vector<std::string>    m_deleteQueue;
-        std::queue<std::string>     m_upQueue;
-        std::queue<std::string>     m_downQueue;
+        std::queue<mvIdentifier>    m_deleteChildrenQueue;
+        std::unordered_set<mvIdentifier> m_deleteQueue; // hashed for isItemToBeDeleted
+        std::queue<mvIdentifier>    m_upQueue;
+        std::queue<mvIdentifier>    m_downQueue;
         std::vector<NewRuntimeItem> m_newItemVec;
         std::vector<OrderedItem>    m_orderedVec;
         std::queue<StolenChild>     m_moveVec;
+        std::vector<NewBatch>       m_newBatchVec;
+
+        // end of frame name index
+        static constexpr int        IndexThreshold = 8; // lookups before the index is built
+        mvTrackedMap<mvIdentifier, mvAppItem*, mvMemoryCategory::Items> m_index;
+        bool                        m_indexBuilt = false;
+        int                         m_indexLookups = 0;
+
+        // batched creation
+        bool                        m_batching = false;
+        std::vector<NewRuntimeItem> m_batchItems;
 
 	};
 
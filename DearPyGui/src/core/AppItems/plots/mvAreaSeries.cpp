@@ -1,94 +1,74 @@
 #include "mvAreaSeries.h"
+#include "mvPolygonFill.h"
 
 namespace Marvel {
 
 	void mvAreaSeries::drawPolygon()
 	{
 
-		ImPlotLimits limits = ImPlot::GetPlotLimits();
-
-		std::vector<ImVec2> points;
-		for (unsigned i = 0; i < m_data[0].size(); i++)
-		{
-			float x = m_data[0][i] > limits.X.Max ? (float)limits.X.Max : (float)m_data[0][i];
-			x = m_data[0][i] < limits.X.Min ? (float)limits.X.Min : x;
-
-			float y = m_data[1][i] > limits.Y.Max ? (float)limits.Y.Max : (float)m_data[1][i];
-			y = m_data[1][i] < limits.Y.Min ? (float)limits.Y.Min : y;
-			auto p = ImPlot::PlotToPixels({ x, y });
-			points.push_back(p);
-		}
+		if (!m_fill.specified || m_data[0].size() < 3)
+			return;
 
-		if (m_fill.specified)
+		if (!m_cached)
 		{
-			size_t i;
-			int y;
-			int miny, maxy;
-			int x1, y1;
-			int x2, y2;
-			int ind1, ind2;
-			size_t ints;
-			size_t n = points.size();
-			int* polyints = new int[n];
-
-			/* Determine Y maxima */
-			miny = (int)points[0].y;
-			maxy = (int)points[0].y;
-			for (i = 1; i < n; i++)
+			// area series are monotone in x in practice, which triangulates in a
+			// single pass. Otherwise the (slower) ear clipping is only done once.
+			bool increasing = true;
+			bool decreasing = true;
+			for (size_t i = 1; i < m_data[0].size(); i++)
 			{
-				miny = std::min(miny, (int)points[i].y);
-				maxy = std::max(maxy, (int)points[i].y);
+				if (m_data[0][i] < m_data[0][i - 1]) increasing = false;
+				if (m_data[0][i] > m_data[0][i - 1]) decreasing = false;
 			}
+			m_monotone = increasing || decreasing;
 
-			/* Draw, scanning y */
-			for (y = miny; y <= maxy; y++) {
-				ints = 0;
-				for (i = 0; (i < n); i++) {
-					if (!i)
-					{
-						ind1 = (int)n - 1;
-						ind2 = 0;
-					}
-					else
-					{
-						ind1 = (int)i - 1;
-						ind2 = (int)i;
-					}
-					y1 = (int)points[ind1].y;
-					y2 = (int)points[ind2].y;
-					if (y1 < y2)
-					{
-						x1 = (int)points[ind1].x;
-						x2 = (int)points[ind2].x;
-					}
-					else if (y1 > y2)
-					{
-						y2 = (int)points[ind1].y;
-						y1 = (int)points[ind2].y;
-						x2 = (int)points[ind1].x;
-						x1 = (int)points[ind2].x;
-					}
-					else
-						continue;
+			if (!m_monotone)
+			{
+				std::vector<ImVec2> points;
+				points.reserve(m_data[0].size());
+				for (size_t i = 0; i < m_data[0].size(); i++)
+					points.push_back({ m_data[0][i], m_data[1][i] });
+				TriangulatePolygon(points, m_plotTriangles);
+			}
+		}
 
-					if (((y >= y1) && (y < y2)) || ((y == maxy) && (y > y1) && (y <= y2)))
-						polyints[ints++] = (y - y1) * (x2 - x1) / (y2 - y1) + x1;
+		ImPlotLimits limits = ImPlot::GetPlotLimits();
+		ImVec2 plotPos = ImPlot::GetPlotPos();
+		ImVec2 plotSize = ImPlot::GetPlotSize();
 
-				}
+		bool viewChanged = !m_cached
+			|| limits.X.Min != m_cachedLimits.X.Min || limits.X.Max != m_cachedLimits.X.Max
+			|| limits.Y.Min != m_cachedLimits.Y.Min || limits.Y.Max != m_cachedLimits.Y.Max
+			|| plotPos.x != m_cachedPlotPos.x || plotPos.y != m_cachedPlotPos.y
+			|| plotSize.x != m_cachedPlotSize.x || plotSize.y != m_cachedPlotSize.y;
 
-				auto compare_int = [](const void* a, const void* b)
-				{
-					return (*(const int*)a) - (*(const int*)b);
-				};
+		if (viewChanged)
+		{
+			if (m_monotone)
+			{
+				std::vector<ImVec2> points;
+				points.reserve(m_data[0].size());
+				for (size_t i = 0; i < m_data[0].size(); i++)
+					points.push_back(ImPlot::PlotToPixels({ m_data[0][i], m_data[1][i] }));
 
-				qsort(polyints, ints, sizeof(int), compare_int);
+				TriangulateMonotoneArea(points, m_triangles);
+			}
 
-				for (i = 0; i < ints; i += 2)
-					ImGui::GetWindowDrawList()->AddLine({ (float)polyints[i], (float)y }, { (float)polyints[i + 1], (float)y }, m_fill, 1.0f);
+			else
+			{
+				m_triangles.resize(m_plotTriangles.size());
+				for (size_t i = 0; i < m_plotTriangles.size(); i++)
+					m_triangles[i] = ImPlot::PlotToPixels({ m_plotTriangles[i].x, m_plotTriangles[i].y });
 			}
-			delete[] polyints;
+
+			m_cachedLimits = limits;
+			m_cachedPlotPos = plotPos;
+			m_cachedPlotSize = plotSize;
+			m_cached = true;
 		}
 
+		AddTrianglesFilled(ImPlot::GetPlotDrawList(), m_triangles, m_fill);
+
 	}
 
 }
@@ -37,6 +37,15 @@ namespace Marvel {
 
 		mvColor m_color = MV_DEFAULT_COLOR;
 		mvColor m_fill = MV_DEFAULT_COLOR;
+
+		// fill triangles in pixels, rebuilt when the view changes
+		std::vector<ImVec2> m_triangles;
+		std::vector<ImVec2> m_plotTriangles; // unsorted data, triangulated once in plot space
+		bool                m_monotone = true; // x increases or decreases throughout
+		ImPlotLimits        m_cachedLimits;
+		ImVec2              m_cachedPlotPos;
+		ImVec2              m_cachedPlotSize;
+		bool                m_cached = false;
 	};
 
 }
\ No newline at end of file
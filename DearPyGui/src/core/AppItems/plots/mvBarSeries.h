@@ -19,10 +19,14 @@ namespace Marvel {
 
 		void draw() override
 		{
+			// only submit the bars whose position falls inside the plot
+			int first, count;
+			getVisibleRange(m_horizontal ? m_data[1] : m_data[0], m_horizontal, m_weight, first, count);
+
 			if(m_horizontal)
-				ImPlot::PlotBarsH(m_name.c_str(), m_data[0].data(), m_data[1].data(), (int)m_data[0].size(), m_weight);
+				ImPlot::PlotBarsH(m_name.c_str(), m_data[0].data() + first, m_data[1].data() + first, count, m_weight);
 			else
-				ImPlot::PlotBars(m_name.c_str(), m_data[0].data(), m_data[1].data(), (int)m_data[0].size(), m_weight);
+				ImPlot::PlotBars(m_name.c_str(), m_data[0].data() + first, m_data[1].data() + first, count, m_weight);
 		}
 
 	private:
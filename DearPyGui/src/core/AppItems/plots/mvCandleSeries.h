@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include "mvPlot.h"
 
 namespace Marvel {
@@ -19,7 +21,7 @@ namespace Marvel {
 
     static void PlotCandlestick(const char* label_id, const float* xs, const float* opens, 
         const float* closes, const float* lows, const float* highs, int count, 
-        bool tooltip, float width_percent, ImVec4 bullCol, ImVec4 bearCol) {
+        bool tooltip, float width_percent, ImVec4 bullCol, ImVec4 bearCol, bool sorted) {
 
         // get ImGui window DrawList
         ImDrawList* draw_list = ImPlot::GetPlotDrawList();
@@ -64,15 +66,54 @@ namespace Marvel {
                     ImPlot::FitPoint(ImPlotPoint(xs[i], highs[i]));
                 }
             }
+            // only candles within the x limits are drawn (all of them while fitting)
+            int first = 0;
+            int last = count;
+            if (sorted && count > 1 && !ImPlot::FitThisFrame()) {
+                ImPlotLimits limits = ImPlot::GetPlotLimits();
+                first = (int)(std::lower_bound(xs, xs + count, (float)(limits.X.Min - half_width)) - xs);
+                last = (int)(std::upper_bound(xs + first, xs + count, (float)(limits.X.Max + half_width)) - xs);
+            }
             // render data
-            for (int i = 0; i < count; ++i) {
-                ImVec2 open_pos = ImPlot::PlotToPixels(xs[i] - half_width, opens[i]);
-                ImVec2 close_pos = ImPlot::PlotToPixels(xs[i] + half_width, closes[i]);
-                ImVec2 low_pos = ImPlot::PlotToPixels(xs[i], lows[i]);
-                ImVec2 high_pos = ImPlot::PlotToPixels(xs[i], highs[i]);
-                ImU32 color = ImGui::GetColorU32(opens[i] > closes[i] ? bearCol : bullCol);
-                draw_list->AddLine(low_pos, high_pos, color);
-                draw_list->AddRectFilled(open_pos, close_pos, color);
+            const float plot_left = ImPlot::GetPlotPos().x;
+            if (sorted && (float)(last - first) > ImPlot::GetPlotSize().x) {
+                // more candles than pixel columns, so merge each column into a single OHLC bar
+                int i = first;
+                while (i < last) {
+                    int column = (int)std::floor(ImPlot::PlotToPixels(xs[i], lows[i]).x - plot_left);
+                    float open = opens[i];
+                    float close = closes[i];
+                    float low = lows[i];
+                    float high = highs[i];
+                    int j = i + 1;
+                    for (; j < last; ++j) {
+                        if ((int)std::floor(ImPlot::PlotToPixels(xs[j], lows[j]).x - plot_left) != column)
+                            break;
+                        low = std::min(low, lows[j]);
+                        high = std::max(high, highs[j]);
+                        close = closes[j];
+                    }
+                    float x = plot_left + (float)column;
+                    float low_y = ImPlot::PlotToPixels(xs[i], low).y;
+                    float high_y = ImPlot::PlotToPixels(xs[i], high).y;
+                    float open_y = ImPlot::PlotToPixels(xs[i], open).y;
+                    float close_y = ImPlot::PlotToPixels(xs[i], close).y;
+                    ImU32 color = ImGui::GetColorU32(open > close ? bearCol : bullCol);
+                    draw_list->AddLine(ImVec2(x + 0.5f, low_y), ImVec2(x + 0.5f, high_y), color);
+                    draw_list->AddRectFilled(ImVec2(x, open_y), ImVec2(x + 1.0f, close_y), color);
+                    i = j;
+                }
+            }
+            else {
+                for (int i = first; i < last; ++i) {
+                    ImVec2 open_pos = ImPlot::PlotToPixels(xs[i] - half_width, opens[i]);
+                    ImVec2 close_pos = ImPlot::PlotToPixels(xs[i] + half_width, closes[i]);
+                    ImVec2 low_pos = ImPlot::PlotToPixels(xs[i], lows[i]);
+                    ImVec2 high_pos = ImPlot::PlotToPixels(xs[i], highs[i]);
+                    ImU32 color = ImGui::GetColorU32(opens[i] > closes[i] ? bearCol : bullCol);
+                    draw_list->AddLine(low_pos, high_pos, color);
+                    draw_list->AddRectFilled(open_pos, close_pos, color);
+                }
             }
 
             // end plot item
@@ -105,6 +146,8 @@ namespace Marvel {
                 minmax = minmax_element(highs->begin(), highs->end());
                 m_maxY = *minmax.second;
             }
+
+            m_sorted = std::is_sorted(dates->begin(), dates->end()) ? 1 : 0;
 			
 		}
 
@@ -115,7 +158,7 @@ namespace Marvel {
 
 			PlotCandlestick(m_name.c_str(), m_data[0].data(), m_data[1].data(), m_data[4].data(),
 				m_data[3].data(), m_data[2].data(), (int)m_data[0].size(), m_tooltip, m_width, m_bullColor.toVec4(), 
-				m_bearColor.toVec4());
+				m_bearColor.toVec4(), m_sorted == 1);
 		}
 
 	private:
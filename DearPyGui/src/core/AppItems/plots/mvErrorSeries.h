@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include "mvPlot.h"
 
 namespace Marvel {
@@ -17,19 +19,28 @@ namespace Marvel {
 			m_horizontal(horizontal), 
 			m_color(color)
 		{
+			// horizontal bars reach past their x position by up to this much
+			if (m_horizontal)
+			{
+				for (size_t i = 0; i < m_data[2].size() && i < m_data[3].size(); i++)
+					m_extent = std::max(m_extent, std::max(std::abs(m_data[2][i]), std::abs(m_data[3][i])));
+			}
 		}
 
 		mvSeriesType getSeriesType() override { return mvSeriesType::Error; }
 
 		void draw() override
 		{
+			int first, count;
+			getVisibleRange(m_data[0], false, m_extent, first, count);
+
 			ImPlot::PushStyleColor(ImPlotCol_ErrorBar, m_color.toVec4());
 			if(m_horizontal)
-				ImPlot::PlotErrorBarsH(m_name.c_str(), m_data[0].data(), m_data[1].data(), m_data[2].data(), 
-					m_data[3].data(), (int)m_data[0].size());
+				ImPlot::PlotErrorBarsH(m_name.c_str(), m_data[0].data() + first, m_data[1].data() + first, m_data[2].data() + first, 
+					m_data[3].data() + first, count);
 			else
-				ImPlot::PlotErrorBars(m_name.c_str(), m_data[0].data(), m_data[1].data(), m_data[2].data(),
-					m_data[3].data(), (int)m_data[0].size());
+				ImPlot::PlotErrorBars(m_name.c_str(), m_data[0].data() + first, m_data[1].data() + first, m_data[2].data() + first,
+					m_data[3].data() + first, count);
 
 			ImPlot::PopStyleColor();
 		}
@@ -38,6 +49,7 @@ namespace Marvel {
 
 		bool    m_horizontal;
 		mvColor m_color;
+		float   m_extent = 0.0f;
 
 	};
 
@@ -0,0 +1,241 @@
+#include "mvHeatSeries.h"
+#include "mvApp.h"
+#include "mvTextureStorage.h"
+#include "mvUtilities.h"
+#include "mvThreadPool.h"
+#include "mvThreadPoolManager.h"
+#include "mvEvents.h"
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+
+namespace Marvel {
+
+	// heatmaps with at least this many cells are colored on the thread pool
+	static constexpr size_t s_asyncCellCount = 1u << 18u;
+
+	// heat textures are sampled without filtering where the backend allows it,
+	// small heatmaps are also upscaled so linear filtering only softens cell edges
+	static constexpr int s_minTextureSize = 512;
+	static constexpr int s_maxCellScale = 16;
+
+	mvHeatSeries::mvHeatSeries(const std::string& name, const std::vector<float>* values,
+		int rows, int cols, double scale_min, double scale_max, const std::string& format,
+		mvVec2 bounds_min, mvVec2 bounds_max, ImPlotYAxis_ axis)
+		:
+		mvSeries(name, {values}, axis),
+		m_rows(rows),
+		m_cols(cols),
+		m_scale_min(scale_min),
+		m_scale_max(scale_max),
+		m_format(format),
+		m_bounds_min(bounds_min),
+		m_bounds_max(bounds_max)
+	{
+		m_minX = bounds_min.x;
+		m_maxX = bounds_max.x;
+		m_minY = bounds_min.y;
+		m_maxY = bounds_max.y;
+
+		// addresses can be reused by later series, ids can't
+		static std::atomic<unsigned> s_textureId = 0u;
+		m_textureName = "INTERNAL_DPG_HEAT_" + std::to_string(++s_textureId);
+
+		int largest = m_rows > m_cols ? m_rows : m_cols;
+		if (largest > 0)
+			m_cellScale = ImClamp(s_minTextureSize / largest, 1, s_maxCellScale);
+	}
+
+	mvHeatSeries::~mvHeatSeries()
+	{
+		if (m_texture)
+			mvEventBus::Publish(mvEVT_CATEGORY_TEXTURE, mvEVT_DEC_TEXTURE, { CreateEventArgument("NAME", m_textureName) });
+	}
+
+	void mvHeatSeries::ColorCells(const float* values, int rows, int cols, int cellScale, double scale_min, double scale_max,
+		const std::vector<ImVec4>& colormap, float alpha, unsigned char* pixels)
+	{
+		size_t rowPitch = (size_t)cols * cellScale * 4u;
+
+		// row 0 is the top of the heatmap, which is also the top of the texture
+		for (int r = 0; r < rows; r++)
+		{
+			unsigned char* row = pixels + (size_t)r * cellScale * rowPitch;
+			for (int c = 0; c < cols; c++)
+			{
+				double t = ImRemap((double)values[(size_t)r * cols + c], scale_min, scale_max, 0.0, 1.0);
+				ImVec4 color = ImPlot::LerpColormap(colormap.data(), (int)colormap.size(), (float)t);
+				color.w *= alpha;
+				ImU32 packed = ImGui::ColorConvertFloat4ToU32(color);
+
+				unsigned char* texel = row + (size_t)c * cellScale * 4u;
+				for (int i = 0; i < cellScale; i++)
+					memcpy(texel + (size_t)i * 4u, &packed, 4u);
+			}
+
+			for (int i = 1; i < cellScale; i++)
+				memcpy(row + (size_t)i * rowPitch, row, rowPitch);
+		}
+	}
+
+	unsigned mvHeatSeries::getColormapSignature() const
+	{
+		// FNV-1a over the active colormap and fill alpha
+		unsigned hash = 2166136261u;
+		auto combine = [&hash](float value)
+		{
+			unsigned bits;
+			memcpy(&bits, &value, sizeof(bits));
+			hash = (hash ^ bits) * 16777619u;
+		};
+
+		for (int i = 0; i < ImPlot::GetColormapSize(); i++)
+		{
+			ImVec4 color = ImPlot::GetColormapColor(i);
+			combine(color.x);
+			combine(color.y);
+			combine(color.z);
+			combine(color.w);
+		}
+		combine(ImPlot::GetStyle().FillAlpha);
+
+		return hash == 0u ? 1u : hash;
+	}
+
+	void mvHeatSeries::updateTexture()
+	{
+		// results from the thread pool
+		if (m_job && m_job->ready)
+		{
+			uploadPixels(m_job->pixels);
+			m_job.reset();
+		}
+
+		if (m_job)
+			return;
+
+		unsigned signature = getColormapSignature();
+		if (signature == m_signature)
+			return;
+		m_signature = signature;
+
+		std::vector<ImVec4> colormap(ImPlot::GetColormapSize());
+		for (int i = 0; i < (int)colormap.size(); i++)
+			colormap[i] = ImPlot::GetColormapColor(i);
+		float alpha = ImPlot::GetStyle().FillAlpha;
+
+		size_t texels = (size_t)m_rows * m_cols * m_cellScale * m_cellScale;
+
+		if ((size_t)m_rows * m_cols < s_asyncCellCount)
+		{
+			std::vector<unsigned char> pixels(texels * 4u);
+			ColorCells(m_data[0].data(), m_rows, m_cols, m_cellScale, m_scale_min, m_scale_max, colormap, alpha, pixels.data());
+			uploadPixels(pixels);
+			return;
+		}
+
+		auto job = std::make_shared<ColorJob>();
+		job->values = m_data[0];
+		m_job = job;
+
+		int rows = m_rows;
+		int cols = m_cols;
+		int cellScale = m_cellScale;
+		double scale_min = m_scale_min;
+		double scale_max = m_scale_max;
+
+		mvThreadPoolManager::GetThreadPoolManager()->getThreadPool()->submit(
+			[job, rows, cols, cellScale, scale_min, scale_max, colormap, alpha, texels]()
+			{
+				job->pixels.resize(texels * 4u);
+				ColorCells(job->values.data(), rows, cols, cellScale, scale_min, scale_max, colormap, alpha, job->pixels.data());
+				job->ready = true;
+			});
+	}
+
+	void mvHeatSeries::uploadPixels(std::vector<unsigned char>& pixels)
+	{
+		// same size every time, so the storage updates the texture in place
+		mvTextureStorage& storage = mvApp::GetApp()->getTextureStorage();
+		storage.addTexture(m_textureName, pixels.data(), m_cols * m_cellScale, m_rows * m_cellScale, mvTextureFormat::RGBA_UINT8, true);
+
+		mvTexture* texture = storage.getTexture(m_textureName);
+		m_texture = texture ? texture->texture : nullptr;
+		m_perCell = m_texture == nullptr;
+	}
+
+	void mvHeatSeries::draw()
+	{
+		if (m_rows <= 0 || m_cols <= 0 || m_data[0].size() < (size_t)m_rows * m_cols)
+			return;
+
+		// checked on the render thread, where the renderer can be queried
+		int maxSize = GetMaxTextureSize();
+		if (m_cols * m_cellScale > maxSize || m_rows * m_cellScale > maxSize)
+			m_perCell = true;
+
+		if (m_perCell)
+		{
+			ImPlot::PlotHeatmap(m_name.c_str(), m_data[0].data(), m_rows, m_cols, m_scale_min, m_scale_max,
+				m_format.c_str(), { m_bounds_min.x, m_bounds_min.y }, { m_bounds_max.x, m_bounds_max.y });
+			return;
+		}
+
+		updateTexture();
+
+		// still being colored on the thread pool
+		if (m_texture == nullptr)
+			return;
+
+		ImPlot::PlotImage(m_name.c_str(), m_texture, { m_bounds_min.x, m_bounds_min.y }, { m_bounds_max.x, m_bounds_max.y });
+
+		if (!m_format.empty())
+		{
+			auto item = ImPlot::RegisterOrGetItem(m_name.c_str());
+			if (item->Show)
+				drawLabels();
+		}
+	}
+
+	void mvHeatSeries::drawLabels()
+	{
+		const double w = ((double)m_bounds_max.x - m_bounds_min.x) / m_cols;
+		const double h = ((double)m_bounds_max.y - m_bounds_min.y) / m_rows;
+
+		// skip labels entirely when the widest one doesn't fit in a cell
+		char buff[32];
+		double widest = fabs(m_scale_min) > fabs(m_scale_max) ? m_scale_min : m_scale_max;
+		snprintf(buff, sizeof(buff), m_format.c_str(), widest);
+		ImVec2 labelSize = ImGui::CalcTextSize(buff);
+
+		ImVec2 p0 = ImPlot::PlotToPixels(m_bounds_min.x, m_bounds_min.y);
+		ImVec2 p1 = ImPlot::PlotToPixels(m_bounds_min.x + w, m_bounds_min.y + h);
+		if (fabs(p1.x - p0.x) < labelSize.x + 2.0f || fabs(p1.y - p0.y) < labelSize.y)
+			return;
+
+		// only cells inside the plot limits
+		ImPlotLimits limits = ImPlot::GetPlotLimits();
+		int c0 = ImClamp((int)floor((limits.X.Min - m_bounds_min.x) / w), 0, m_cols);
+		int c1 = ImClamp((int)ceil((limits.X.Max - m_bounds_min.x) / w), 0, m_cols);
+		int r0 = ImClamp((int)floor((m_bounds_max.y - limits.Y.Max) / h), 0, m_rows);
+		int r1 = ImClamp((int)ceil((m_bounds_max.y - limits.Y.Min) / h), 0, m_rows);
+
+		ImDrawList& drawList = *ImPlot::GetPlotDrawList();
+		ImPlot::PushPlotClipRect();
+		for (int r = r0; r < r1; r++)
+		{
+			for (int c = c0; c < c1; c++)
+			{
+				float value = m_data[0][(size_t)r * m_cols + c];
+				snprintf(buff, sizeof(buff), m_format.c_str(), value);
+				ImVec2 size = ImGui::CalcTextSize(buff);
+				ImVec2 px = ImPlot::PlotToPixels(m_bounds_min.x + (c + 0.5) * w, m_bounds_max.y - (r + 0.5) * h);
+				double t = ImRemap((double)value, m_scale_min, m_scale_max, 0.0, 1.0);
+				ImU32 color = ImPlot::CalcTextColor(ImPlot::LerpColormap((float)t));
+				drawList.AddText(ImVec2(px.x - size.x * 0.5f, px.y - size.y * 0.5f), color, buff);
+			}
+		}
+		ImPlot::PopPlotClipRect();
+	}
+
+}
@@ -1,42 +1,59 @@
 #pragma once
 
+#include <memory>
+#include <atomic>
 #include "mvPlot.h"
 
+//-----------------------------------------------------------------------------
+// mvHeatSeries
+//
+//     - Cells are colored into a texture which is drawn as a single image
+//       instead of one rect per cell. The texture is only rebuilt when the
+//       colormap or fill alpha changes (new data creates a new series).
+//
+//     - Large heatmaps are colored on the thread pool. Heatmaps wider or
+//       taller than the renderer's largest texture (or whose texture
+//       couldn't be created) are drawn per cell by ImPlot instead.
+//
+//     - Labels are only drawn for visible cells large enough to fit them.
+//     
+//-----------------------------------------------------------------------------
+
 namespace Marvel {
 
 	class mvHeatSeries : public mvSeries
 	{
 
+		// shared with the coloring task so late results
+		// never touch a deleted series
+		struct ColorJob
+		{
+			std::vector<float>         values;
+			std::vector<unsigned char> pixels;
+			std::atomic_bool           ready = false;
+		};
+
 	public:
 
 		mvHeatSeries(const std::string& name, const std::vector<float>* values, 
 			int rows, int cols, double scale_min, double scale_max, const std::string& format,
-			mvVec2 bounds_min, mvVec2 bounds_max, ImPlotYAxis_ axis)
-			: 
-			mvSeries(name, {values}, axis),
-			m_rows(rows), 
-			m_cols(cols), 
-			m_scale_min(scale_min),
-			m_scale_max(scale_max), 
-			m_format(format), 
-			m_bounds_min(bounds_min), 
-			m_bounds_max(bounds_max)
-		{
-			m_minX = bounds_min.x;
-			m_maxX = bounds_max.x;
-			m_minY = bounds_min.y;
-			m_maxY = bounds_max.y;
-		}
+			mvVec2 bounds_min, mvVec2 bounds_max, ImPlotYAxis_ axis);
+
+		~mvHeatSeries() override;
 
 		mvSeriesType getSeriesType() override { return mvSeriesType::Heat; }
 
-		void draw() override
-		{
+		void draw() override;
+
+	private:
 
-			ImPlot::PlotHeatmap(m_name.c_str(), m_data[0].data(), m_rows, m_cols, m_scale_min, m_scale_max,
-				m_format.c_str(), { m_bounds_min.x, m_bounds_min.y }, { m_bounds_max.x, m_bounds_max.y });
-		
-		}
+		static void ColorCells(const float* values, int rows, int cols, int cellScale, double scale_min, double scale_max,
+			const std::vector<ImVec4>& colormap, float alpha, unsigned char* pixels);
+
+		unsigned getColormapSignature() const;
+		void     updateTexture       ();
+		void     uploadPixels        (std::vector<unsigned char>& pixels);
+		void     drawLabels          ();
 
 	private:
 
@@ -48,6 +65,13 @@ namespace Marvel {
 		mvVec2      m_bounds_min;
 		mvVec2      m_bounds_max;
 
+		std::string               m_textureName;
+		void*                     m_texture = nullptr;
+		int                       m_cellScale = 1; // texels per cell side
+		unsigned                  m_signature = 0u;
+		std::shared_ptr<ColorJob> m_job;
+		bool                      m_perCell = false; // no texture, ImPlot::PlotHeatmap draws the cells
+
 	};
 
-}
\ No newline at end of file
+}
@@ -24,16 +24,36 @@ namespace Marvel {
 			m_uv_max(uv_max),
 			m_tintColor(tintColor)
 		{
+			mvEventBus::Subscribe(this, mvEVT_DELETE_TEXTURE);
+			mvEventBus::Subscribe(this, mvEVT_TEXTURE_LOADED);
 		}
 
 		bool onEvent(mvEvent& event)
 		{
 			mvEventDispatcher dispatcher(event);
 			dispatcher.dispatch(BIND_EVENT_METH(mvImageSeries::onTextureDeleted), mvEVT_DELETE_TEXTURE);
+			dispatcher.dispatch(BIND_EVENT_METH(mvImageSeries::onTextureLoaded), mvEVT_TEXTURE_LOADED);
 
 			return event.handled;
 		}
 
+		bool onTextureLoaded(mvEvent& event)
+		{
+			// placeholder was swapped for the uploaded texture
+			if (m_texture && GetEString(event, "NAME") == m_value)
+			{
+				if (mvTexture* texture = mvApp::GetApp()->getTextureStorage().getTexture(m_value))
+				{
+					m_texture = texture->texture;
+					m_texture_uv_min = texture->uv_min;
+					m_texture_uv_max = texture->uv_max;
+				}
+			}
+
+			// other series may share this texture
+			return false;
+		}
+
 		bool onTextureDeleted(mvEvent& event)
 		{
 			std::string name = GetEString(event, "NAME");
@@ -52,12 +72,18 @@ namespace Marvel {
 		void draw() override
 		{
 			if(m_texture)
-				ImPlot::PlotImage(m_name.c_str(), m_texture, m_bounds_min, m_bounds_max, m_uv_min, m_uv_max, m_tintColor.toVec4());
+				ImPlot::PlotImage(m_name.c_str(), m_texture, m_bounds_min, m_bounds_max,
+					MapTextureUV(m_texture_uv_min, m_texture_uv_max, m_uv_min), MapTextureUV(m_texture_uv_min, m_texture_uv_max, m_uv_max), m_tintColor.toVec4());
 			else
 			{
 				mvApp::GetApp()->getTextureStorage().addTexture(m_value);
 				mvTexture* texture = mvApp::GetApp()->getTextureStorage().getTexture(m_value);
-				m_texture = texture->texture;
+				if (texture)
+				{
+					m_texture = texture->texture;
+					m_texture_uv_min = texture->uv_min;
+					m_texture_uv_max = texture->uv_max;
+				}
 			}
 		}
 
@@ -76,6 +102,8 @@ namespace Marvel {
 		mvVec2	    m_uv_max = { 1.0f, 1.0f };
 		mvColor     m_tintColor = { 0, 0, 0, 255, true };
 		void*       m_texture = nullptr;
+		mvVec2      m_texture_uv_min = { 0.0f, 0.0f }; // image area within m_texture
+		mvVec2      m_texture_uv_max = { 1.0f, 1.0f };
 
 	};
 
@@ -7,6 +7,7 @@
 #include "mvInput.h"
 #include "mvValueStorage.h"
 #include "mvGlobalIntepreterLock.h"
+#include "mvCostTracker.h"
 
 namespace Marvel {
 
@@ -50,6 +51,10 @@ namespace Marvel {
 			}
 		}
 
+		for (const auto& list : m_data)
+			m_dataBytes += list.capacity() * sizeof(float);
+		mvMemory::Record(mvMemoryCategory::PlotData, m_dataBytes);
+
 	}
 
 	mvSeries::mvSeries(std::string name, const ImPlotPoint& boundsMin, const ImPlotPoint& boundsMax, ImPlotYAxis_ axis)
@@ -63,6 +68,40 @@ namespace Marvel {
 		m_minY = (float)boundsMin.y;
 	}
 
+	mvSeries::~mvSeries()
+	{
+		if (m_dataBytes > 0)
+			mvMemory::Release(mvMemoryCategory::PlotData, m_dataBytes);
+	}
+
+	void mvSeries::getVisibleRange(const std::vector<float>& values, bool yAxis, double margin, int& first, int& count)
+	{
+		first = 0;
+		count = (int)values.size();
+
+		// series data never changes after creation so the check is done once
+		if (m_sorted == -1)
+			m_sorted = std::is_sorted(values.begin(), values.end()) ? 1 : 0;
+
+		if (m_sorted == 0 || count < 2 || ImPlot::FitThisFrame())
+			return;
+
+		ImPlotLimits limits = ImPlot::GetPlotLimits();
+		const ImPlotRange& range = yAxis ? limits.Y : limits.X;
+
+		auto begin = std::lower_bound(values.begin(), values.end(), (float)(range.Min - margin));
+		auto end = std::upper_bound(begin, values.end(), (float)(range.Max + margin));
+
+		// keep the neighbours so primitives straddling the edge are not cut off
+		if (begin != values.begin())
+			begin--;
+		if (end != values.end())
+			end++;
+
+		first = (int)(begin - values.begin());
+		count = (int)(end - begin);
+	}
+
 	mvPlot::mvPlot(const std::string& name, PyObject* queryCallback)
 		: mvAppItem(name), m_queryCallback(queryCallback)
 	{
@@ -507,6 +546,7 @@ namespace Marvel {
 				default:
 					break;
 				}
+				mvCostScope cost(series->getName(), mvCostType::Series, &m_name);
 				series->draw();
 			}
 
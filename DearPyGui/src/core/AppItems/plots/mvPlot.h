@@ -6,6 +6,7 @@
 #include <map>
 #include <utility>
 #include "mvCore.h"
+#include "mvMemory.h"
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
 
@@ -223,7 +224,9 @@ namespace Marvel {
 
 		mvSeries(std::string name, const ImPlotPoint& boundsMin, const ImPlotPoint& boundsMax, ImPlotYAxis_ axis = ImPlotYAxis_1);
 
-		virtual ~mvSeries() = default;
+		virtual ~mvSeries();
+
+		MV_TRACK_ALLOCATIONS(mvMemoryCategory::PlotData)
 
 		virtual void draw() = 0;
 		virtual mvSeriesType getSeriesType() = 0;
@@ -234,6 +237,12 @@ namespace Marvel {
 
 	protected:
 
+		// Index range [first, first + count) of the points whose coordinate in
+		// values lies inside the current plot limits widened by margin (plot
+		// units) plus one point on either side. Returns the whole series while
+		// the plot is fitting or when values is not sorted ascending.
+		void getVisibleRange(const std::vector<float>& values, bool yAxis, double margin, int& first, int& count);
+
 		std::string                     m_name;
 		ImPlotYAxis_                    m_axis = ImPlotYAxis_1;
 		std::vector<std::vector<float>> m_data;
@@ -243,6 +252,8 @@ namespace Marvel {
 		float                           m_minX;
 		float                           m_minY;
 		float                           m_weight;
+		int                             m_sorted = -1; // -1 until getVisibleRange checks
+		size_t                          m_dataBytes = 0; // counted as plot data
 		
 	};
 }
@@ -35,7 +35,10 @@ namespace Marvel {
 			ImPlot::PushStyleVar(ImPlotStyleVar_MarkerSize, m_markerSize);
 			ImPlot::PushStyleVar(ImPlotStyleVar_MarkerWeight, m_markerWeight);
 
-			ImPlot::PlotStems(m_name.c_str(), m_data[0].data(), m_data[1].data(), (int)m_data[0].size());
+			int first, count;
+			getVisibleRange(m_data[0], false, 0.0, first, count);
+
+			ImPlot::PlotStems(m_name.c_str(), m_data[0].data() + first, m_data[1].data() + first, count);
 
 			ImPlot::PopStyleColor();
 			ImPlot::PopStyleColor();
@@ -2,6 +2,7 @@
 #include <imgui.h>
 #include <string>
 #include "mvCore.h"
+#include "mvMemory.h"
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
 
@@ -29,6 +30,9 @@ namespace Marvel {
 	public:
 
 		virtual ~mvDrawCmd() = default;
+
+		MV_TRACK_ALLOCATIONS(mvMemoryCategory::DrawLists)
+
 		virtual void          draw(ImDrawList* draw_list, float x, float y) = 0;
 		virtual mvDrawCmdType getType() const = 0;
 		virtual void          setConfigDict(PyObject* dict) = 0;
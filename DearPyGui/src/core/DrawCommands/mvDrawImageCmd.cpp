@@ -17,6 +17,7 @@ namespace Marvel {
 		m_color(color)
 	{
 		mvEventBus::Subscribe(this, mvEVT_DELETE_TEXTURE);
+		mvEventBus::Subscribe(this, mvEVT_TEXTURE_LOADED);
 	}
 
 	mvDrawImageCmd::~mvDrawImageCmd()
@@ -29,10 +30,28 @@ namespace Marvel {
 	{
 		mvEventDispatcher dispatcher(event);
 		dispatcher.dispatch(BIND_EVENT_METH(mvDrawImageCmd::onTextureDeleted), mvEVT_DELETE_TEXTURE);
+		dispatcher.dispatch(BIND_EVENT_METH(mvDrawImageCmd::onTextureLoaded), mvEVT_TEXTURE_LOADED);
 
 		return event.handled;
 	}
 
+	bool mvDrawImageCmd::onTextureLoaded(mvEvent& event)
+	{
+		// placeholder was swapped for the uploaded texture
+		if (m_texture && GetEString(event, "NAME") == m_file)
+		{
+			if (mvTexture* texture = mvApp::GetApp()->getTextureStorage().getTexture(m_file))
+			{
+				m_texture = texture->texture;
+				m_texture_uv_min = texture->uv_min;
+				m_texture_uv_max = texture->uv_max;
+			}
+		}
+
+		// other items may share this texture
+		return false;
+	}
+
 	bool mvDrawImageCmd::onTextureDeleted(mvEvent& event)
 	{
 		std::string name = GetEString(event, "NAME");
@@ -65,6 +84,8 @@ namespace Marvel {
 			}
 
 			m_texture = texture->texture;
+			m_texture_uv_min = texture->uv_min;
+			m_texture_uv_max = texture->uv_max;
 
 			if (m_width == 0) m_width = (int)((float)texture->width * (m_uv_max.x - m_uv_min.x));
 			if (m_height == 0) m_height = (int)((float)texture->height * (m_uv_max.y - m_uv_min.y));
@@ -74,7 +95,8 @@ namespace Marvel {
 		mvVec2 start = {x, y};
 
 		if (m_texture)
-			drawlist->AddImage(m_texture, m_pmin + start, m_pmax + start, m_uv_min, m_uv_max, m_color);
+			drawlist->AddImage(m_texture, m_pmin + start, m_pmax + start,
+				MapTextureUV(m_texture_uv_min, m_texture_uv_max, m_uv_min), MapTextureUV(m_texture_uv_min, m_texture_uv_max, m_uv_max), m_color);
 	}
 
 	void mvDrawImageCmd::setConfigDict(PyObject* dict)
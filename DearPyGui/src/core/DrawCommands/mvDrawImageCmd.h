@@ -16,6 +16,7 @@ namespace Marvel {
 
 		bool onEvent(mvEvent& event) override;
 		bool onTextureDeleted(mvEvent& event);
+		bool onTextureLoaded (mvEvent& event);
 
 		void draw         (ImDrawList* drawlist, float x, float y) override;
 		void setConfigDict(PyObject* dict)                         override;
@@ -32,6 +33,8 @@ namespace Marvel {
 		mvVec2		m_uv_max;
 		mvColor		m_color;
 		void*       m_texture = nullptr;
+		mvVec2      m_texture_uv_min = { 0.0f, 0.0f }; // image area within m_texture
+		mvVec2      m_texture_uv_max = { 1.0f, 1.0f };
 		int         m_width = 0;
 		int         m_height = 0;
 	};
@@ -24,6 +24,8 @@ namespace Marvel {
 		mvColor             m_color;
 		mvColor             m_fill;
 		float               m_thickness;
+		std::vector<ImVec2> m_triangles; // cached fill
+		bool                m_triangulationDirty = true;
 
 	};
 
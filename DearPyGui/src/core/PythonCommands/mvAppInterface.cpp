@@ -5,6 +5,14 @@
 #include "mvThreadPoolManager.h"
 #include <ImGuiFileDialog.h>
 #include "mvDataStorage.h"
+#include "mvPyObject.h"
+#include "mvGlobalIntepreterLock.h"
+#include "mvProfiler.h"
+#include "mvCostTracker.h"
+#include "mvFrameStats.h"
+#include "mvMemory.h"
+#include "mvIdentifier.h"
+#include "platform/Headless/mvHeadlessWindow.h"
 
 namespace Marvel {
 
@@ -12,7 +20,7 @@ namespace Marvel {
 	{
 		parsers->insert({ "add_texture", mvPythonParser({
 			{mvPythonDataType::String, "name"},
-			{mvPythonDataType::IntList, "data", "RGBA format"},
+			{mvPythonDataType::IntList, "data", "RGBA format (bytes-like objects are accepted for mvTEX_XXXX_UINT8 formats)"},
 			{mvPythonDataType::Integer, "width"},
 			{mvPythonDataType::Integer, "height"},
 			{mvPythonDataType::KeywordOnly},
@@ -23,6 +31,31 @@ namespace Marvel {
 			{mvPythonDataType::String, "name"},
 		}, "Decrements a texture.") });
 
+		parsers->insert({ "update_texture", mvPythonParser({
+			{mvPythonDataType::String, "name"},
+			{mvPythonDataType::IntList, "data", "pixels of the region being replaced"},
+			{mvPythonDataType::Integer, "x"},
+			{mvPythonDataType::Integer, "y"},
+			{mvPythonDataType::Integer, "width"},
+			{mvPythonDataType::Integer, "height"},
+			{mvPythonDataType::KeywordOnly},
+			{mvPythonDataType::Integer, "format", "mvTEX_XXXX_XXXXX constants", "0"},
+		}, "Replaces a region of an existing texture without recreating it.") });
+
+		parsers->insert({ "set_async_texture_loading", mvPythonParser({
+			{mvPythonDataType::Bool, "value"},
+			{mvPythonDataType::KeywordOnly},
+			{mvPythonDataType::Integer, "upload_budget", "maximum bytes uploaded to the GPU per frame", "4194304"},
+			{mvPythonDataType::Callable, "callback", "called with the file name as sender once an image is uploaded, None removes it", "None"},
+		}, "Decodes image files on the threadpool, showing a placeholder until they are ready.") });
+
+		parsers->insert({ "set_texture_atlas", mvPythonParser({
+			{mvPythonDataType::Bool, "value"},
+			{mvPythonDataType::KeywordOnly},
+			{mvPythonDataType::Integer, "page_size", "width and height of each atlas page (only changes before images are packed)", "1024"},
+			{mvPythonDataType::Integer, "max_image_size", "images larger than this in either dimension get their own texture", "128"},
+		}, "Packs small image files into shared textures so many images can be drawn in a single draw call.") });
+
 		parsers->insert({ "enable_docking", mvPythonParser({
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::Bool, "shift_only", "press shift for docking", "True"},
@@ -45,6 +78,12 @@ namespace Marvel {
 			{mvPythonDataType::Bool, "value"},
 		}, "Sets vsync on or off.") });
 
+		parsers->insert({ "set_power_saving", mvPythonParser({
+			{mvPythonDataType::Bool, "value"},
+			{mvPythonDataType::Optional},
+			{mvPythonDataType::Float, "max_idle", "longest time in seconds between frames while idle", "1.0"},
+		}, "Only renders when input arrives or something changes instead of every frame (Linux).") });
+
 		parsers->insert({ "is_dearpygui_running", mvPythonParser({
 		}, "Checks if dearpygui is still running", "bool") });
 
@@ -78,11 +117,48 @@ namespace Marvel {
 		parsers->insert({ "start_dearpygui", mvPythonParser({
 			{mvPythonDataType::KeywordOnly},
 			{mvPythonDataType::String, "primary_window", "Window that will expand into viewport.", "''"},
+			{mvPythonDataType::Bool, "headless", "Runs without a window or GPU, draw data is discarded.", "False"},
+			{mvPythonDataType::Integer, "frames", "Frames to run when headless (0 runs until stopped).", "0"},
 		}, "Starts DearPyGui.") });
 
+		parsers->insert({ "get_headless_draw_stats", mvPythonParser({
+		}, "Returns frames rendered and vertices, indices, draw lists and draw commands discarded by the last headless run.", "dict") });
+
 		parsers->insert({ "stop_dearpygui", mvPythonParser({
 		}, "Stops DearPyGui.") });
 
+		parsers->insert({ "start_profiling", mvPythonParser({
+			{mvPythonDataType::Optional},
+			{mvPythonDataType::Integer, "events_per_thread", "events kept per thread, later events are dropped", "65536"},
+		}, "Starts recording profiler scopes on every thread, discarding the previous recording.") });
+
+		parsers->insert({ "stop_profiling", mvPythonParser({
+		}, "Stops recording profiler scopes. The recording is kept until profiling starts again.") });
+
+		parsers->insert({ "save_profile", mvPythonParser({
+			{mvPythonDataType::String, "file"},
+		}, "Saves the last profiler recording as Chrome trace JSON (chrome://tracing or Perfetto).") });
+
+		parsers->insert({ "set_frame_cost_sampling", mvPythonParser({
+			{mvPythonDataType::Integer, "interval", "frames between samples, 0 disables"},
+		}, "Samples the time spent drawing each item and plot series and running each callback. Clears previous samples.") });
+
+		parsers->insert({ "get_frame_cost_breakdown", mvPythonParser({
+			{mvPythonDataType::Optional},
+			{mvPythonDataType::Integer, "top", "only the most expensive entries, 0 returns all", "0"},
+		}, "Returns the sampled self times (ms) as dicts with name, type, average, max, calls and frames, most expensive first.", "List[dict]") });
+
+		parsers->insert({ "get_frame_stats", mvPythonParser({
+		}, "Returns frames, dropped frames, target_fps and p50/p95/p99/max/mean times (ms) for frame, pre_render, render, end_frame and present.", "dict") });
+
+		parsers->insert({ "reset_frame_stats", mvPythonParser({
+			{mvPythonDataType::Optional},
+			{mvPythonDataType::Float, "target_fps", "frames slower than 1.5x the target interval count as dropped", "60.0"},
+		}, "Clears the frame statistics.") });
+
+		parsers->insert({ "get_memory_stats", mvPythonParser({
+		}, "Returns bytes, peak, allocations and total_allocations for imgui, items, value_storage, plot_data, draw_lists, textures, textures_gpu, logger and names (the interned item name table, which also reports its entries), plus the total bytes.", "dict") });
+
 		parsers->insert({ "set_global_font_scale", mvPythonParser({
 			{mvPythonDataType::Float, "scale", "default is 1.0"}
 		}, "Changes the global font scale.") });
@@ -238,13 +314,38 @@ namespace Marvel {
 		int height;
 		int format = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_texture"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_texture"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&name, &data, &width, &height, &format))
 			return GetPyNone();
 
+		if (!IsTextureFormat(format))
+		{
+			ThrowPythonException("add_texture format " + std::to_string(format) + " for \"" + std::string(name) + "\" is not a texture format.");
+			return GetPyNone();
+		}
+
 		mvTextureFormat tformat = (mvTextureFormat)format;
 
-		if (tformat == mvTextureFormat::RGBA_INT)
+		if (IsByteTextureFormat(tformat))
+		{
+			std::vector<unsigned char> mdata = ToUCharVect(data);
+			if (mdata.size() < (size_t)width * (size_t)height * GetTextureFormatSize(tformat))
+			{
+				ThrowPythonException("add_texture data for \"" + std::string(name) + "\" is smaller than width * height.");
+				return GetPyNone();
+			}
+
+			if (mvApp::IsAppStarted())
+				mvApp::GetApp()->getTextureStorage().addTexture(name, mdata.data(), width, height, tformat);
+
+			else
+				mvApp::GetApp()->getTextureStorage().addDelayedTexture(name, std::move(mdata), width, height, tformat);
+			return GetPyNone();
+		}
+
+		else if (tformat == mvTextureFormat::RGBA_INT)
 		{
 			std::vector<int> mdata = ToIntVect(data);
 
@@ -320,7 +421,9 @@ namespace Marvel {
 		int shift_only = true;
 		int dockspace = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["enable_docking"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["enable_docking"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&shift_only, &dockspace))
 			return GetPyNone();
 
@@ -333,7 +436,9 @@ namespace Marvel {
 	{
 		const char* name;
 
-		if (!(*mvApp::GetApp()->getParsers())["decrement_texture"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["decrement_texture"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&name))
 			return GetPyNone();
 
@@ -342,6 +447,174 @@ namespace Marvel {
 		return GetPyNone();
 	}
 
+	PyObject* update_texture(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		const char* name;
+		PyObject* data;
+		int x;
+		int y;
+		int width;
+		int height;
+		int format = 0;
+
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["update_texture"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
+			&name, &data, &x, &y, &width, &height, &format))
+			return GetPyNone();
+
+		if (!mvApp::IsAppStarted())
+		{
+			ThrowPythonException("update_texture can only be called while DearPyGui is running.");
+			return GetPyNone();
+		}
+
+		if (x < 0 || y < 0 || width <= 0 || height <= 0)
+		{
+			ThrowPythonException("update_texture region for \"" + std::string(name) + "\" is invalid.");
+			return GetPyNone();
+		}
+
+		if (!IsTextureFormat(format))
+		{
+			ThrowPythonException("update_texture format " + std::to_string(format) + " for \"" + std::string(name) + "\" is not a texture format.");
+			return GetPyNone();
+		}
+
+		mvTextureStorage& storage = mvApp::GetApp()->getTextureStorage();
+		mvTexture* texture = storage.getTexture(name);
+		mvTextureFormat tformat = (mvTextureFormat)format;
+		unsigned channels = GetTextureFormatSize(tformat);
+		bool isInt = tformat == mvTextureFormat::RGBA_INT || tformat == mvTextureFormat::RGB_INT;
+		size_t pixels = (size_t)width * (size_t)height;
+		bool updated = false;
+
+		if (IsByteTextureFormat(tformat))
+		{
+			std::vector<unsigned char> mdata = ToUCharVect(data);
+			if (mdata.size() < pixels * channels)
+			{
+				ThrowPythonException("update_texture data for \"" + std::string(name) + "\" is smaller than the region.");
+				return GetPyNone();
+			}
+
+			if (texture == nullptr || texture->ubyte)
+				updated = storage.updateTexture(name, mdata.data(), x, y, width, height, tformat);
+
+			else
+			{
+				// float texture, so convert to the RGBA float layout used for uploads
+				std::vector<float> fdata;
+				fdata.reserve(pixels * 4u);
+				for (size_t i = 0; i < pixels; i++)
+				{
+					const unsigned char* pixel = &mdata[i * channels];
+					fdata.push_back(pixel[0] / 255.0f);
+					fdata.push_back(pixel[channels > 1u ? 1u : 0u] / 255.0f);
+					fdata.push_back(pixel[channels > 1u ? 2u : 0u] / 255.0f);
+					fdata.push_back(channels == 4u ? pixel[3] / 255.0f : 1.0f);
+				}
+				updated = storage.updateTexture(name, fdata.data(), x, y, width, height);
+			}
+		}
+
+		else
+		{
+			std::vector<float> mdata = ToFloatVect(data);
+			if (mdata.size() < pixels * channels)
+			{
+				ThrowPythonException("update_texture data for \"" + std::string(name) + "\" is smaller than the region.");
+				return GetPyNone();
+			}
+
+			float scale = isInt ? 1.0f / 255.0f : 1.0f;
+
+			if (texture && texture->ubyte)
+			{
+				// byte texture, so convert to RGBA bytes
+				std::vector<unsigned char> bdata;
+				bdata.reserve(pixels * 4u);
+				auto tobyte = [scale](float value) { value = value * scale * 255.0f; return (unsigned char)(value < 0.0f ? 0.0f : (value > 255.0f ? 255.0f : value + 0.5f)); };
+				for (size_t i = 0; i < pixels; i++)
+				{
+					const float* pixel = &mdata[i * channels];
+					bdata.push_back(tobyte(pixel[0]));
+					bdata.push_back(tobyte(pixel[1]));
+					bdata.push_back(tobyte(pixel[2]));
+					bdata.push_back(channels == 4u ? tobyte(pixel[3]) : 255u);
+				}
+				updated = storage.updateTexture(name, bdata.data(), x, y, width, height, mvTextureFormat::RGBA_UINT8);
+			}
+
+			else
+			{
+				// convert to the RGBA float layout used for uploads
+				std::vector<float> fdata;
+				fdata.reserve(pixels * 4u);
+				for (size_t i = 0; i < pixels; i++)
+				{
+					const float* pixel = &mdata[i * channels];
+					fdata.push_back(pixel[0] * scale);
+					fdata.push_back(pixel[1] * scale);
+					fdata.push_back(pixel[2] * scale);
+					fdata.push_back(channels == 4u ? pixel[3] * scale : 1.0f);
+				}
+				updated = storage.updateTexture(name, fdata.data(), x, y, width, height);
+			}
+		}
+
+		if (!updated)
+			ThrowPythonException("Texture \"" + std::string(name) + "\" could not be updated (missing, still loading, or region out of bounds).");
+
+		return GetPyNone();
+	}
+
+	PyObject* set_async_texture_loading(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		int value;
+		int upload_budget = 4194304;
+		PyObject* callback = nullptr;
+
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_async_texture_loading"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
+			&value, &upload_budget, &callback))
+			return GetPyNone();
+
+		mvApp::GetApp()->getTextureStorage().setAsyncLoading(value);
+		mvApp::GetApp()->getTextureStorage().setUploadBudget(upload_budget > 0 ? (unsigned)upload_budget : 0u);
+
+		// None clears the callback, queued calls may still use the old one so it isn't released
+		if (callback)
+			Py_XINCREF(callback);
+		mvCallbackRegistry::GetCallbackRegistry()->setTextureLoadedCallback(callback);
+
+		return GetPyNone();
+	}
+
+	PyObject* set_texture_atlas(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		int value;
+		int page_size = 1024;
+		int max_image_size = 128;
+
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_texture_atlas"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
+			&value, &page_size, &max_image_size))
+			return GetPyNone();
+
+		if (page_size < 64 || max_image_size < 1)
+		{
+			ThrowPythonException("set_texture_atlas requires a page_size of at least 64 and a positive max_image_size.");
+			return GetPyNone();
+		}
+
+		mvApp::GetApp()->getTextureStorage().setAtlasMode(value, page_size, max_image_size);
+
+		return GetPyNone();
+	}
+
 	PyObject* is_dearpygui_running(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 		return ToPyBool(mvApp::IsAppStarted());
@@ -351,7 +624,9 @@ namespace Marvel {
 	{
 		const char* title;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_main_window_title"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_main_window_title"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&title))
 			return GetPyNone();
 
@@ -368,7 +643,9 @@ namespace Marvel {
 		int x;
 		int y;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_main_window_pos"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_main_window_pos"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&x, &y))
 			return GetPyNone();
 
@@ -382,7 +659,9 @@ namespace Marvel {
 		int destination;
 		int source;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_character_remap"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_character_remap"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&destination, &source))
 			return GetPyNone();
 
@@ -395,7 +674,9 @@ namespace Marvel {
 	{
 		int resizable = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_main_window_resizable"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_main_window_resizable"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&resizable))
 			return GetPyNone();
 
@@ -409,7 +690,9 @@ namespace Marvel {
 
 		int value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_vsync"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_vsync"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -417,6 +700,22 @@ namespace Marvel {
 		return GetPyNone();
 	}
 
+	PyObject* set_power_saving(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+
+		int value;
+		float max_idle = 1.0f;
+
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_power_saving"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
+			&value, &max_idle))
+			return GetPyNone();
+
+		mvApp::GetApp()->setPowerSaving(value, max_idle > 0.0f ? max_idle : 1.0f);
+		return GetPyNone();
+	}
+
 	PyObject* setup_dearpygui(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
@@ -455,8 +754,13 @@ namespace Marvel {
 	PyObject* start_dearpygui(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 		const char* primary_window = "";
+		int headless = false;
+		int frames = 0;
+
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["start_dearpygui"];
 
-		if (!(*mvApp::GetApp()->getParsers())["start_dearpygui"].parse(args, kwargs, __FUNCTION__, &primary_window))
+		if (!parser.parse(args, kwargs, __FUNCTION__, &primary_window,
+			&headless, &frames))
 			return GetPyNone();
 		if (mvApp::IsAppStarted())
 		{
@@ -464,18 +768,212 @@ namespace Marvel {
 			return GetPyNone();
 		}
 
-		mvApp::GetApp()->start(primary_window);
+		if (headless)
+			mvApp::GetApp()->startHeadless(primary_window, frames);
+		else
+			mvApp::GetApp()->start(primary_window);
 		
 		mvApp::DeleteApp();
 
 		return GetPyNone();
 	}
 
+	PyObject* get_headless_draw_stats(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		const mvHeadlessDrawStats& stats = mvHeadlessWindow::GetDrawStats();
+
+		mvGlobalIntepreterLock gil;
+		PyObject* dict = PyDict_New();
+		mvPyObject frames(PyLong_FromLongLong(stats.frames));
+		mvPyObject vertices(PyLong_FromLongLong(stats.vertices));
+		mvPyObject indices(PyLong_FromLongLong(stats.indices));
+		mvPyObject lists(PyLong_FromLongLong(stats.lists));
+		mvPyObject commands(PyLong_FromLongLong(stats.commands));
+		PyDict_SetItemString(dict, "frames", frames);
+		PyDict_SetItemString(dict, "vertices", vertices);
+		PyDict_SetItemString(dict, "indices", indices);
+		PyDict_SetItemString(dict, "draw_lists", lists);
+		PyDict_SetItemString(dict, "draw_commands", commands);
+		return dict;
+	}
+
+	PyObject* start_profiling(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		int events_per_thread = mvInstrumentor::DefaultEventsPerThread;
+
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["start_profiling"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &events_per_thread))
+			return GetPyNone();
+
+		mvInstrumentor::Get().BeginSession("DearPyGui", events_per_thread);
+		return GetPyNone();
+	}
+
+	PyObject* stop_profiling(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		mvInstrumentor::Get().EndSession();
+		return GetPyNone();
+	}
+
+	PyObject* save_profile(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		const char* file;
+
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["save_profile"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &file))
+			return GetPyNone();
+
+		if (!mvInstrumentor::Get().WriteChromeTrace(file))
+			ThrowPythonException("save_profile could not write \"" + std::string(file) + "\".");
+
+		return GetPyNone();
+	}
+
+	PyObject* set_frame_cost_sampling(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		int interval;
+
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_frame_cost_sampling"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &interval))
+			return GetPyNone();
+
+		mvCostTracker::SetSampleInterval(interval);
+		mvCostTracker::Reset();
+		return GetPyNone();
+	}
+
+	PyObject* get_frame_cost_breakdown(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		int top = 0;
+
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_frame_cost_breakdown"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &top))
+			return GetPyNone();
+
+		std::vector<mvCost> costs = mvCostTracker::GetBreakdown(top);
+
+		mvGlobalIntepreterLock gil;
+		PyObject* result = PyList_New(costs.size());
+		for (size_t i = 0; i < costs.size(); i++)
+		{
+			const mvCost& cost = costs[i];
+			PyObject* dict = PyDict_New();
+			mvPyObject name(ToPyString(cost.name, gil));
+			mvPyObject type(ToPyString(mvCostTracker::GetTypeName(cost.type), gil));
+			mvPyObject average(PyFloat_FromDouble(cost.average));
+			mvPyObject max(PyFloat_FromDouble(cost.max));
+			mvPyObject calls(PyLong_FromLong(cost.calls));
+			mvPyObject frames(PyLong_FromLong(cost.frames));
+			PyDict_SetItemString(dict, "name", name);
+			PyDict_SetItemString(dict, "type", type);
+			PyDict_SetItemString(dict, "average", average);
+			PyDict_SetItemString(dict, "max", max);
+			PyDict_SetItemString(dict, "calls", calls);
+			PyDict_SetItemString(dict, "frames", frames);
+			PyList_SetItem(result, i, dict);
+		}
+
+		return result;
+	}
+
+	PyObject* get_frame_stats(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		mvGlobalIntepreterLock gil;
+		PyObject* dict = PyDict_New();
+
+		for (int i = 0; i < (int)mvFramePhase::Count; i++)
+		{
+			mvFrameStats::Summary summary = mvFrameStats::GetSummary((mvFramePhase)i);
+
+			mvPyObject phase(PyDict_New());
+			mvPyObject p50(PyFloat_FromDouble(summary.p50));
+			mvPyObject p95(PyFloat_FromDouble(summary.p95));
+			mvPyObject p99(PyFloat_FromDouble(summary.p99));
+			mvPyObject max(PyFloat_FromDouble(summary.max));
+			mvPyObject mean(PyFloat_FromDouble(summary.mean));
+			PyDict_SetItemString(phase, "p50", p50);
+			PyDict_SetItemString(phase, "p95", p95);
+			PyDict_SetItemString(phase, "p99", p99);
+			PyDict_SetItemString(phase, "max", max);
+			PyDict_SetItemString(phase, "mean", mean);
+			PyDict_SetItemString(dict, mvFrameStats::GetPhaseName((mvFramePhase)i), phase);
+
+			if (i == (int)mvFramePhase::Frame)
+			{
+				mvPyObject frames(PyLong_FromUnsignedLongLong(summary.count));
+				PyDict_SetItemString(dict, "frames", frames);
+			}
+		}
+
+		mvPyObject dropped(PyLong_FromUnsignedLongLong(mvFrameStats::GetDroppedFrames()));
+		mvPyObject target(PyFloat_FromDouble(mvFrameStats::GetTargetFps()));
+		PyDict_SetItemString(dict, "dropped", dropped);
+		PyDict_SetItemString(dict, "target_fps", target);
+		return dict;
+	}
+
+	PyObject* reset_frame_stats(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		float target_fps = 60.0f;
+
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["reset_frame_stats"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &target_fps))
+			return GetPyNone();
+
+		mvFrameStats::Reset(target_fps);
+		return GetPyNone();
+	}
+
+	PyObject* get_memory_stats(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		mvGlobalIntepreterLock gil;
+		mvMemory::Refresh();
+
+		PyObject* dict = PyDict_New();
+		int64_t total = 0;
+
+		for (int i = 0; i < (int)mvMemoryCategory::Count; i++)
+		{
+			mvMemoryStats stats = mvMemory::GetStats((mvMemoryCategory)i);
+			total += stats.bytes;
+
+			mvPyObject category(PyDict_New());
+			mvPyObject bytes(PyLong_FromLongLong(stats.bytes));
+			mvPyObject peak(PyLong_FromLongLong(stats.peak));
+			mvPyObject allocations(PyLong_FromLongLong(stats.allocations));
+			mvPyObject totalAllocations(PyLong_FromUnsignedLongLong(stats.totalAllocations));
+			PyDict_SetItemString(category, "bytes", bytes);
+			PyDict_SetItemString(category, "peak", peak);
+			PyDict_SetItemString(category, "allocations", allocations);
+			PyDict_SetItemString(category, "total_allocations", totalAllocations);
+			if ((mvMemoryCategory)i == mvMemoryCategory::Names)
+			{
+				size_t names = 0;
+				size_t nameBytes = 0;
+				mvIdentifier::GetTableStats(names, nameBytes);
+				mvPyObject entries(PyLong_FromSize_t(names));
+				PyDict_SetItemString(category, "entries", entries);
+			}
+			PyDict_SetItemString(dict, mvMemory::GetCategoryName((mvMemoryCategory)i), category);
+		}
+
+		mvPyObject totalBytes(PyLong_FromLongLong(total));
+		PyDict_SetItemString(dict, "total", totalBytes);
+		return dict;
+	}
+
 	PyObject* set_start_callback(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 		PyObject* callback;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_start_callback"].parse(args, kwargs, __FUNCTION__, &callback))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_start_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &callback))
 			return GetPyNone();
 
 		mvCallbackRegistry::GetCallbackRegistry()->setOnStartCallback(callback);
@@ -486,7 +984,9 @@ namespace Marvel {
 	{
 		PyObject* callback;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_exit_callback"].parse(args, kwargs, __FUNCTION__, &callback))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_exit_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &callback))
 			return GetPyNone();
 
 		mvCallbackRegistry::GetCallbackRegistry()->setOnCloseCallback(callback);
@@ -497,7 +997,9 @@ namespace Marvel {
 	{
 		PyObject* callback;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_accelerator_callback"].parse(args, kwargs, __FUNCTION__, &callback))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_accelerator_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &callback))
 			return GetPyNone();
 
 		mvCallbackRegistry::GetCallbackRegistry()->setAcceleratorCallback(callback);
@@ -516,7 +1018,9 @@ namespace Marvel {
 		PyObject* return_handler = nullptr;
 		PyObject* data;
 
-		if (!(*mvApp::GetApp()->getParsers())["run_async_function"].parse(args, kwargs, __FUNCTION__, &callback, &data, &return_handler))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["run_async_function"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &callback, &data, &return_handler))
 			return GetPyNone();
 
 		if (callback)
@@ -537,7 +1041,9 @@ namespace Marvel {
 	{
 		PyObject* callback = nullptr;
 
-		if (!(*mvApp::GetApp()->getParsers())["select_directory_dialog"].parse(args, kwargs, __FUNCTION__, &callback))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["select_directory_dialog"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &callback))
 			return GetPyNone();
 
 		igfd::ImGuiFileDialog::Instance()->OpenModal("ChooseFileDlgKey", "Choose Directory", 0, ".");
@@ -556,7 +1062,9 @@ namespace Marvel {
 		PyObject* callback = nullptr;
 		const char* extensions = ".*";
 
-		if (!(*mvApp::GetApp()->getParsers())["open_file_dialog"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["open_file_dialog"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&callback, &extensions))
 			return GetPyNone();
 
@@ -615,7 +1123,9 @@ namespace Marvel {
 	{
 		float time;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_threadpool_timeout"].parse(args, kwargs, __FUNCTION__, &time))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_threadpool_timeout"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &time))
 			return GetPyNone();
 
 		mvThreadPoolManager::GetThreadPoolManager()->setThreadPoolTimeout(time);
@@ -627,7 +1137,9 @@ namespace Marvel {
 	{
 		int threads;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_thread_count"].parse(args, kwargs, __FUNCTION__, &threads))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_thread_count"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &threads))
 			return GetPyNone();
 
 		mvThreadPoolManager::GetThreadPoolManager()->setThreadCount(threads);
@@ -641,7 +1153,9 @@ namespace Marvel {
 		const char* name;
 		PyObject* data;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_data"].parse(args, kwargs, __FUNCTION__, &name, &data))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_data"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &data))
 			return GetPyNone();
 
 		mvDataStorage::AddData(name, data);
@@ -655,7 +1169,9 @@ namespace Marvel {
 
 		const char* name;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_data"].parse(args, kwargs, __FUNCTION__, &name))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_data"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name))
 			return GetPyNone();
 
 		auto result = mvDataStorage::GetDataIncRef(name);
@@ -671,7 +1187,9 @@ namespace Marvel {
 
 		const char* name;
 
-		if (!(*mvApp::GetApp()->getParsers())["delete_data"].parse(args, kwargs, __FUNCTION__, &name))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["delete_data"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name))
 			return GetPyNone();
 
 		mvDataStorage::DeleteData(name);
@@ -690,7 +1208,9 @@ namespace Marvel {
 		int width;
 		int height;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_main_window_size"].parse(args, kwargs, __FUNCTION__, &width, &height))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_main_window_size"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &width, &height))
 			return GetPyNone();
 
 		mvEventBus::Publish(mvEVT_CATEGORY_VIEWPORT, mvEVT_VIEWPORT_RESIZE, {
@@ -707,7 +1227,9 @@ namespace Marvel {
 	{
 		const char* logger = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["get_log_level"].parse(args, kwargs, __FUNCTION__, &logger))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_log_level"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &logger))
 			return GetPyNone();
 
 		if (!std::string(logger).empty())
@@ -736,7 +1258,9 @@ namespace Marvel {
 	{
 		int level;
 		const char* logger = "";
-		if (!(*mvApp::GetApp()->getParsers())["set_log_level"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_log_level"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&level, &logger))
 			return GetPyNone();
 
@@ -770,7 +1294,9 @@ namespace Marvel {
 		PyObject* message;
 		const char* level = "TRACE";
 		const char* logger = "";
-		if (!(*mvApp::GetApp()->getParsers())["log"].parse(args, kwargs, __FUNCTION__, &message, &level, &logger))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["log"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &message, &level, &logger))
 			return GetPyNone();
 
 		if (!std::string(logger).empty())
@@ -803,7 +1329,9 @@ namespace Marvel {
 		PyObject* message;
 		const char* logger = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["log_debug"].parse(args, kwargs, __FUNCTION__, &message, &logger))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["log_debug"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &message, &logger))
 			return GetPyNone();
 
 		if (!std::string(logger).empty())
@@ -836,7 +1364,9 @@ namespace Marvel {
 		PyObject* message;
 		const char* logger = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["log_info"].parse(args, kwargs, __FUNCTION__, &message, &logger))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["log_info"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &message, &logger))
 			return GetPyNone();
 
 		if (!std::string(logger).empty())
@@ -868,7 +1398,9 @@ namespace Marvel {
 		PyObject* message;
 		const char* logger = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["log_warning"].parse(args, kwargs, __FUNCTION__, &message, &logger))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["log_warning"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &message, &logger))
 			return GetPyNone();
 
 		if (!std::string(logger).empty())
@@ -900,7 +1432,9 @@ namespace Marvel {
 		PyObject* message;
 		const char* logger = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["log_error"].parse(args, kwargs, __FUNCTION__, &message, &logger))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["log_error"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &message, &logger))
 			return GetPyNone();
 
 		if (!std::string(logger).empty())
@@ -931,7 +1465,9 @@ namespace Marvel {
 	{
 		const char* logger = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["clear_log"].parse(args, kwargs, __FUNCTION__, &logger))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["clear_log"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &logger))
 			return GetPyNone();
 
 		if (!std::string(logger).empty())
@@ -968,7 +1504,9 @@ namespace Marvel {
 	{
 		const char* popup;
 
-		if (!(*mvApp::GetApp()->getParsers())["close_popup"].parse(args, kwargs, __FUNCTION__, &popup))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["close_popup"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &popup))
 			return GetPyNone();
 
 
@@ -999,7 +1537,9 @@ namespace Marvel {
 		const char* item;
 		int value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_primary_window"].parse(args, kwargs, __FUNCTION__, &item, &value))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_primary_window"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item, &value))
 			return GetPyNone();
 
 
@@ -13,7 +13,16 @@ namespace Marvel {
 	// app
 	PyObject* is_dearpygui_running           (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* start_dearpygui                (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* get_headless_draw_stats        (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* stop_dearpygui                 (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* start_profiling                (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* stop_profiling                 (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* save_profile                   (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* set_frame_cost_sampling        (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* get_frame_cost_breakdown       (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* get_frame_stats                (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* reset_frame_stats              (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* get_memory_stats               (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* set_start_callback             (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* set_exit_callback              (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* set_accelerator_callback       (PyObject* self, PyObject* args, PyObject* kwargs);
@@ -21,6 +30,7 @@ namespace Marvel {
 	PyObject* render_dearpygui_frame         (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* cleanup_dearpygui              (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* set_vsync                      (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* set_power_saving               (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* get_dearpygui_version          (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* get_active_window              (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* add_character_remap            (PyObject* self, PyObject* args, PyObject* kwargs);
@@ -48,6 +58,9 @@ namespace Marvel {
 	// texture storage
 	PyObject* add_texture                    (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* decrement_texture              (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* update_texture                 (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* set_async_texture_loading      (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* set_texture_atlas              (PyObject* self, PyObject* args, PyObject* kwargs);
 	
 	// concurrency
 	PyObject* set_threadpool_timeout         (PyObject* self, PyObject* args, PyObject* kwargs);
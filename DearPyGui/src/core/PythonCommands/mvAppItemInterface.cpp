@@ -2,6 +2,8 @@
 #include "mvEvents.h"
 #include <ImGuiFileDialog.h>
 #include "mvValueStorage.h"
+#include "mvPyObject.h"
+#include "mvMarvel.h"
 
 namespace Marvel {
 
@@ -25,6 +27,15 @@ namespace Marvel {
 			{mvPythonDataType::String, "before", "", "''"}
 		}, "Moves an existing item.", "None", "Widget Commands") });
 
+		parsers->insert({ "add_items", mvPythonParser({
+			{mvPythonDataType::Object, "items"},
+			{mvPythonDataType::KeywordOnly},
+			{mvPythonDataType::String, "parent", "Parent for items that name neither parent nor before", "''"},
+			{mvPythonDataType::String, "before", "Sibling for items that name neither parent nor before", "''"}
+		}, "Adds a list of items, each a dict of an add command's keywords plus its 'type' "
+			"(i.e. 'input_text'). Items may use earlier items as their parent. The batch is "
+			"attached to the tree in one step.", "bool", "Widget Commands") });
+
 		parsers->insert({ "get_item_type", mvPythonParser({
 			{mvPythonDataType::String, "item"}
 		}, "Returns an item's type", "str", "Widget Commands") });
@@ -160,7 +171,9 @@ namespace Marvel {
 		}, "Returns an item's current size. [width, height]", "[float, float]", "Widget Commands") });
 
 		parsers->insert({ "get_value", mvPythonParser({
-			{mvPythonDataType::String, "name"}
+			{mvPythonDataType::String, "name"},
+			{mvPythonDataType::KeywordOnly},
+			{mvPythonDataType::Bool, "buffer", "Numeric list values are returned as a read-only memoryview snapshot (float32/int32) instead of a list", "False"},
 		}, "Returns an item's value or None if there is none.", "Any", "Widget Commands") });
 
 		parsers->insert({ "set_value", mvPythonParser({
@@ -219,7 +232,9 @@ namespace Marvel {
 		const char* managed_columns;
 		int column;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_managed_column_width"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_managed_column_width"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&managed_columns, &column))
 			return ToPyFloat(0.0f);
 
@@ -251,7 +266,9 @@ namespace Marvel {
 		int column;
 		float width;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_managed_column_width"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_managed_column_width"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&managed_columns, &column, &width))
 			return GetPyNone();
 
@@ -276,6 +293,86 @@ namespace Marvel {
 		return GetPyNone();
 	}
 
+	PyObject* add_items(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		if (!mvApp::GetApp()->checkIfMainThread())
+			return GetPyNone();
+
+		PyObject* items;
+		const char* parent = "";
+		const char* before = "";
+
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_items"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &items, &parent, &before))
+			return GetPyNone();
+
+		if (!PyList_Check(items))
+		{
+			ThrowPythonException("add_items requires a list of dicts.");
+			return GetPyNone();
+		}
+
+		auto& registry = mvApp::GetApp()->getItemRegistry();
+
+		mvPyObject emptyArgs(PyTuple_New(0));
+		mvPyObject typeKey(PyUnicode_FromString("type"));
+
+		registry.beginBatch();
+
+		for (Py_ssize_t i = 0; i < PyList_Size(items); i++)
+		{
+			PyObject* spec = PyList_GetItem(items, i);
+			if (!PyDict_Check(spec))
+			{
+				ThrowPythonException("add_items entry " + std::to_string(i) + " is not a dict.");
+				continue;
+			}
+
+			PyObject* type = PyDict_GetItem(spec, typeKey);
+			if (type == nullptr || !PyUnicode_Check(type))
+			{
+				ThrowPythonException("add_items entry " + std::to_string(i) + " has no 'type'.");
+				continue;
+			}
+
+			std::string command = PyUnicode_AsUTF8(type);
+			if (command.rfind("add_", 0) != 0)
+				command = "add_" + command;
+
+			PyObject* function = command == "add_items" ? nullptr : GetPythonCommand(command);
+			if (function == nullptr)
+			{
+				ThrowPythonException("add_items entry " + std::to_string(i) + ": " + command + " is not an add command.");
+				continue;
+			}
+
+			mvPyObject keywords(PyDict_Copy(spec));
+			PyDict_DelItem(keywords, typeKey);
+
+			if (PyDict_GetItemString(keywords, "parent") == nullptr && PyDict_GetItemString(keywords, "before") == nullptr)
+			{
+				if (parent[0] != 0)
+				{
+					mvPyObject defaultParent(PyUnicode_FromString(parent));
+					PyDict_SetItemString(keywords, "parent", defaultParent);
+				}
+				if (before[0] != 0)
+				{
+					mvPyObject defaultBefore(PyUnicode_FromString(before));
+					PyDict_SetItemString(keywords, "before", defaultBefore);
+				}
+			}
+
+			PyObject* result = PyObject_Call(function, emptyArgs, keywords);
+			if (result == nullptr)
+				PyErr_Print();
+			Py_XDECREF(result);
+		}
+
+		return ToPyBool(registry.endBatch());
+	}
+
 	PyObject* move_item(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
@@ -283,7 +380,9 @@ namespace Marvel {
 		const char* parent = "";
 		const char* before = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["move_item"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["move_item"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&item, &parent, &before))
 			return GetPyNone();
 
@@ -297,11 +396,13 @@ namespace Marvel {
 		return GetPyNone();
 	}
 
-	PyObject* get_item_configuration(PyObject* self, PyObject* args, PyObject* kwargs)
+	PyObject* get_item_configuration(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_item_configuration"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_item_configuration"];
+
+		if (!parser.parseFast(args, nargs, kwnames, __FUNCTION__, &item))
 			return GetPyNone();
 
 		if (std::string(item) == "logger##standard")
@@ -326,11 +427,23 @@ namespace Marvel {
 		return GetPyNone();
 	}
 
-	PyObject* configure_item(PyObject* self, PyObject* args, PyObject* kwargs)
+	PyObject* configure_item(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
 	{
 		mvGlobalIntepreterLock gil;
 
-		std::string item = ToString(PyTuple_GetItem(args, 0));
+		if (nargs < 1)
+		{
+			ThrowPythonException("configure_item requires the item name.");
+			return GetPyNone();
+		}
+
+		std::string item = ToString(args[0]);
+
+		// configuration keywords follow the positional arguments
+		mvPyObject kwargs(PyDict_New());
+		Py_ssize_t kwcount = kwnames ? PyTuple_GET_SIZE(kwnames) : 0;
+		for (Py_ssize_t i = 0; i < kwcount; i++)
+			PyDict_SetItem(kwargs, PyTuple_GET_ITEM(kwnames, i), args[nargs + i]);
 
 		if (std::string(item) == "logger##standard")
 		{
@@ -360,7 +473,9 @@ namespace Marvel {
 		const char* item;
 		int childrenOnly = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["delete_item"].parse(args, kwargs, __FUNCTION__, &item, &childrenOnly))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["delete_item"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item, &childrenOnly))
 			return GetPyNone();
 
 		mvEventBus::Publish(mvEVT_CATEGORY_ITEM, mvEVT_DELETE_ITEM,
@@ -373,14 +488,16 @@ namespace Marvel {
 
 	}
 
-	PyObject* does_item_exist(PyObject * self, PyObject * args, PyObject * kwargs)
+	PyObject* does_item_exist(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
 	{
 		if (!mvApp::GetApp()->checkIfMainThread())
 			return GetPyNone();
 
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["does_item_exist"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["does_item_exist"];
+
+		if (!parser.parseFast(args, nargs, kwnames, __FUNCTION__, &item))
 			return GetPyNone();
 
 		if (mvApp::GetApp()->getItemRegistry().isItemToBeDeleted(item))
@@ -400,7 +517,9 @@ namespace Marvel {
 
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["move_item_up"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["move_item_up"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		mvEventBus::Publish(mvEVT_CATEGORY_ITEM, mvEVT_MOVE_ITEM_UP,
@@ -419,7 +538,9 @@ namespace Marvel {
 
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["move_item_down"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["move_item_down"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		mvEventBus::Publish(mvEVT_CATEGORY_ITEM, mvEVT_MOVE_ITEM_DOWN,
@@ -435,7 +556,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_item_callback"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_item_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -458,7 +581,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_item_children"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_item_children"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto childlist = mvApp::GetApp()->getItemRegistry().getItemChildren(item);
@@ -488,7 +613,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_item_parent"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_item_parent"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto parent = mvApp::GetApp()->getItemRegistry().getItemParentName(item);
@@ -499,11 +626,13 @@ namespace Marvel {
 		return GetPyNone();
 	}
 
-	PyObject* is_item_hovered(PyObject* self, PyObject* args, PyObject* kwargs)
+	PyObject* is_item_hovered(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_item_hovered"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_item_hovered"];
+
+		if (!parser.parseFast(args, nargs, kwnames, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -518,7 +647,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_item_shown"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_item_shown"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -529,11 +660,13 @@ namespace Marvel {
 		return GetPyNone();
 	}
 
-	PyObject* is_item_active(PyObject* self, PyObject* args, PyObject* kwargs)
+	PyObject* is_item_active(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_item_active"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_item_active"];
+
+		if (!parser.parseFast(args, nargs, kwnames, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -548,7 +681,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_item_focused"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_item_focused"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -563,7 +698,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_item_clicked"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_item_clicked"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -578,7 +715,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_item_container"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_item_container"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -589,11 +728,13 @@ namespace Marvel {
 		return GetPyNone();
 	}
 
-	PyObject* is_item_visible(PyObject* self, PyObject* args, PyObject* kwargs)
+	PyObject* is_item_visible(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_item_visible"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_item_visible"];
+
+		if (!parser.parseFast(args, nargs, kwnames, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -608,7 +749,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_item_edited"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_item_edited"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -623,7 +766,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_item_activated"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_item_activated"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -638,7 +783,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_item_deactivated"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_item_deactivated"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -653,7 +800,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_item_deactivated_after_edit"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_item_deactivated_after_edit"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -668,7 +817,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_item_toggled_open"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_item_toggled_open"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -683,7 +834,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_item_rect_min"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_item_rect_min"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -701,7 +854,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_item_rect_max"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_item_rect_max"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -719,7 +874,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_item_rect_size"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_item_rect_size"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -733,22 +890,27 @@ namespace Marvel {
 		return GetPyNone();
 	}
 
-	PyObject* get_value(PyObject* self, PyObject* args, PyObject* kwargs)
+	PyObject* get_value(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
 	{
 		const char* name;
+		int buffer = false;
+
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_value"];
 
-		if (!(*mvApp::GetApp()->getParsers())["get_value"].parse(args, kwargs, __FUNCTION__, &name))
+		if (!parser.parseFast(args, nargs, kwnames, __FUNCTION__, &name, &buffer))
 			return GetPyNone();
 
-		return mvApp::GetApp()->getValueStorage().GetPyValue(name);
+		return mvApp::GetApp()->getValueStorage().GetPyValue(name, buffer);
 	}
 
-	PyObject* set_value(PyObject* self, PyObject* args, PyObject* kwargs)
+	PyObject* set_value(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
 	{
 		const char* name;
 		PyObject* value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_value"].parse(args, kwargs, __FUNCTION__, &name, &value))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_value"];
+
+		if (!parser.parseFast(args, nargs, kwnames, __FUNCTION__, &name, &value))
 			return GetPyNone();
 
 		if (value)
@@ -768,7 +930,9 @@ namespace Marvel {
 		const char* name;
 		PyObject* value;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_value"].parse(args, kwargs, __FUNCTION__, &name, &value))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_value"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &value))
 			return GetPyNone();
 
 		mvApp::GetApp()->getValueStorage().AddPyValue(name, value);
@@ -779,7 +943,9 @@ namespace Marvel {
 	{
 		const char* name;
 
-		if (!(*mvApp::GetApp()->getParsers())["incref_value"].parse(args, kwargs, __FUNCTION__, &name))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["incref_value"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name))
 			return GetPyNone();
 
 		mvApp::GetApp()->getValueStorage().IncrementRef(name);
@@ -790,7 +956,9 @@ namespace Marvel {
 	{
 		const char* name;
 
-		if (!(*mvApp::GetApp()->getParsers())["decref_value"].parse(args, kwargs, __FUNCTION__, &name))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["decref_value"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name))
 			return GetPyNone();
 
 		mvApp::GetApp()->getValueStorage().DecrementRef(name);
@@ -803,7 +971,9 @@ namespace Marvel {
 		PyObject* callback_data = nullptr;
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_item_callback"].parse(args, kwargs, __FUNCTION__, &item, &callback, &callback_data))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_item_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item, &callback, &callback_data))
 			return GetPyNone();
 
 		mvAppItem* appitem;
@@ -830,7 +1000,9 @@ namespace Marvel {
 	{
 		const char* name;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_item_type"].parse(args, kwargs, __FUNCTION__, &name))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_item_type"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name))
 			return GetPyNone();
 
 		mvAppItem* item = mvApp::GetApp()->getItemRegistry().getItem(std::string(name));
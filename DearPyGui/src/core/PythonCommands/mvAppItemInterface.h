@@ -6,15 +6,16 @@ namespace Marvel {
 	void AddItemCommands(std::map<std::string, mvPythonParser>* parsers);
 
 	PyObject* get_item_type                 (PyObject* self, PyObject* args, PyObject* kwargs);
-	PyObject* get_item_configuration        (PyObject* self, PyObject* args, PyObject* kwargs);
-	PyObject* configure_item                (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* get_item_configuration        (PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames);
+	PyObject* configure_item                (PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames);
 
 	// replacing
 	PyObject* set_item_callback             (PyObject* self, PyObject* args, PyObject* kwargs);
 
 	PyObject* move_item                     (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* add_items                     (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* delete_item                   (PyObject* self, PyObject* args, PyObject* kwargs);
-	PyObject* does_item_exist               (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* does_item_exist               (PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames);
 	PyObject* move_item_up                  (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* move_item_down                (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* get_item_callback             (PyObject* self, PyObject* args, PyObject* kwargs);
@@ -28,13 +29,13 @@ namespace Marvel {
 	PyObject* set_managed_column_width      (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* get_managed_column_width      (PyObject* self, PyObject* args, PyObject* kwargs);
 
-	PyObject* is_item_hovered               (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* is_item_hovered               (PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames);
 	PyObject* is_item_shown                 (PyObject* self, PyObject* args, PyObject* kwargs);
-	PyObject* is_item_active                (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* is_item_active                (PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames);
 	PyObject* is_item_focused               (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* is_item_clicked               (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* is_item_container             (PyObject* self, PyObject* args, PyObject* kwargs);
-	PyObject* is_item_visible               (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* is_item_visible               (PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames);
 	PyObject* is_item_edited                (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* is_item_activated             (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* is_item_deactivated           (PyObject* self, PyObject* args, PyObject* kwargs);
@@ -43,8 +44,8 @@ namespace Marvel {
 	PyObject* get_item_rect_min             (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* get_item_rect_max             (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* get_item_rect_size            (PyObject* self, PyObject* args, PyObject* kwargs);
-	PyObject* get_value                     (PyObject* self, PyObject* args, PyObject* kwargs);
-	PyObject* set_value                     (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* get_value                     (PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames);
+	PyObject* set_value                     (PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames);
 	PyObject* add_value                     (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* incref_value                  (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* decref_value                  (PyObject* self, PyObject* args, PyObject* kwargs);
@@ -501,7 +501,9 @@ namespace Marvel {
 		int autosize_x = false;
 		int autosize_y = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_logger"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_logger"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&name, &logLevel, &autoScroll, &autoScrollButton, &copyButton, &clearButton,
 			&filter, &width, &height, &parent, &before, &show, &autosize_x, &autosize_y))
 			return ToPyBool(false);
@@ -527,7 +529,9 @@ namespace Marvel {
 		const char* parent = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_time_picker"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_time_picker"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&name, &default_value, &hour24, &callback, &callback_data, &tip, &parent, &before, &show))
 			return ToPyBool(false);
 
@@ -558,7 +562,9 @@ namespace Marvel {
 		const char* parent = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_date_picker"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_date_picker"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&name, &default_value, &level, &callback, &callback_data, &tip, &parent, &before, &show))
 			return ToPyBool(false);
 
@@ -595,7 +601,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_simple_plot"].parse(args, kwargs, __FUNCTION__, &name, &value, &overlay,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_simple_plot"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &value, &overlay,
 			&minscale, &maxscale, &histogram, &tip, &parent, &before, &width, &height, &source, &label, &popup, &show))
 			return ToPyBool(false);
 
@@ -624,7 +632,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_progress_bar"].parse(args, kwargs, __FUNCTION__, &name, &default_value,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_progress_bar"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value,
 			&overlay, &tip, &parent, &before, &source, &width, &height, &popup, &show))
 			return ToPyBool(false);
 
@@ -666,7 +676,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_image"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_image"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&value, &tintcolor, &bordercolor, &tip, &parent, &before, &source, &width,
 			&height, &uv_min, &uv_max, &popup, &show))
 			return ToPyBool(false);
@@ -716,7 +728,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_image_button"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_image_button"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&name, &value, &callback, &callback_data, &tintcolor, &backgroundColor, &tip, &parent,
 			&before, &width, &height, &frame_padding, &uv_min, &uv_max, &popup, &show))
 			return ToPyBool(false);
@@ -760,7 +774,9 @@ namespace Marvel {
 		const char* default_value= "";
 
 
-		if (!(*mvApp::GetApp()->getParsers())["add_text"].parse(args, kwargs, __FUNCTION__, &name, &wrap,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_text"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &wrap,
 			&color, &bullet, &tip, &parent, &before, &popup, &source, &default_value, &show))
 			return ToPyBool(false);
 
@@ -792,7 +808,9 @@ namespace Marvel {
 		int show = true;
 
 
-		if (!(*mvApp::GetApp()->getParsers())["add_label_text"].parse(args, kwargs, __FUNCTION__, &name, &value,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_label_text"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &value,
 			&color, &tip, &parent, &before, &source, &label, &popup, &show))
 			return ToPyBool(false);
 
@@ -824,7 +842,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_listbox"].parse(args, kwargs, __FUNCTION__, &name, &items,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_listbox"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &items,
 			&default_value, &callback, &callback_data, &tip, &parent, &before, &source, &enabled, &width,
 			&num_items, &label, &popup, &show))
 			return ToPyBool(false);
@@ -869,7 +889,9 @@ namespace Marvel {
 		int no_preview = false;
 
 
-		if (!(*mvApp::GetApp()->getParsers())["add_combo"].parse(args, kwargs, __FUNCTION__, &name, &items,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_combo"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &items,
 			&default_value, &callback, &callback_data, &tip, &parent, &before, &source, &enabled, &width,
 			&label, &popup, &show, &popup_align_left, &height_small, &height_regular, &height_large, 
 			&height_largest, &no_arrow_button, &no_preview))
@@ -908,7 +930,9 @@ namespace Marvel {
 
 		//ImGuiSelectableFlags flags = ImGuiSelectableFlags_None;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_selectable"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_selectable"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&default_value, &callback, &callback_data, &tip, &parent, &before, &source, &enabled,
 			&label, &popup, &show, &span_columns))
 			return ToPyBool(false);
@@ -946,7 +970,9 @@ namespace Marvel {
 		int show = true;
 		int enabled = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_button"].parse(args, kwargs, __FUNCTION__, &name, &smallb,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_button"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &smallb,
 			&arrow, &direction, &callback, &callback_data, &tip, &parent, &before, &width, &height,
 			&label, &popup, &show, &enabled))
 			return ToPyBool(false);
@@ -976,7 +1002,9 @@ namespace Marvel {
 		const char* parent = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_indent"].parse(args, kwargs, __FUNCTION__, &name, &offset,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_indent"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &offset,
 			&parent, &before, &show))
 			return ToPyBool(false);
 
@@ -999,7 +1027,9 @@ namespace Marvel {
 		const char* parent = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["unindent"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["unindent"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&name, &offset, &parent, &before, &show))
 			return ToPyBool(false);
 
@@ -1022,7 +1052,9 @@ namespace Marvel {
 		const char* parent = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_spacing"].parse(args, kwargs, __FUNCTION__, &name, &count,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_spacing"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &count,
 			&parent, &before, &show))
 			return ToPyBool(false);
 
@@ -1046,7 +1078,9 @@ namespace Marvel {
 		const char* parent = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_dummy"].parse(args, kwargs, __FUNCTION__, &width, &height, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_dummy"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &width, &height, &name,
 			&parent, &before, &show))
 			return ToPyBool(false);
 
@@ -1070,7 +1104,9 @@ namespace Marvel {
 		const char* parent = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_same_line"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_same_line"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&xoffset, &spacing, &parent, &before, &show))
 			return ToPyBool(false);
 
@@ -1099,7 +1135,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_radio_button"].parse(args, kwargs, __FUNCTION__, &name, &items,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_radio_button"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &items,
 			&default_value, &callback, &callback_data, &tip, &parent, &before, &source, &enabled, &horizontal,
 			&popup, &show))
 			return ToPyBool(false);
@@ -1129,7 +1167,9 @@ namespace Marvel {
 		const char* parent = "";
 		const char* before = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["add_separator"].parse(args, kwargs, __FUNCTION__, &name, &tip, &parent, &before))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_separator"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &tip, &parent, &before))
 			return ToPyBool(false);
 
 		mvAppItem* item = new mvSeparator(name);
@@ -1178,7 +1218,9 @@ namespace Marvel {
 		int input_hsv = false;
 
 
-		if (!(*mvApp::GetApp()->getParsers())["add_color_edit3"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_color_edit3"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&default_value, &callback, &callback_data, &tip, &parent, &before, &source, &width, &height,
 			&label, &popup, &show, &no_alpha, &no_picker, &no_options, &no_small_preview, &no_inputs, &no_tooltip, &no_label, &no_drag_drop,
 			&alpha_bar, &alpha_preview, &alpha_preview_half, &display_rgb, &display_hsv, &display_hex, &unit8, &floats, &input_rgb, &input_hsv))
@@ -1240,7 +1282,9 @@ namespace Marvel {
 		int input_rgb = false;
 		int input_hsv = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_color_edit4"].parse(args, kwargs, __FUNCTION__, &name, &default_value,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_color_edit4"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value,
 			&callback, &callback_data, &tip, &parent, &before, &source, &width, &height, &label, &popup, &show,
 			&no_alpha, &no_picker, &no_options, &no_small_preview, &no_inputs, &no_tooltip, &no_label, &no_drag_drop,
 			&alpha_bar, &alpha_preview, &alpha_preview_half, &display_rgb, &display_hsv, &display_hex, &unit8, &floats, &input_rgb, &input_hsv))
@@ -1303,7 +1347,9 @@ namespace Marvel {
 		int input_hsv = false;
 
 
-		if (!(*mvApp::GetApp()->getParsers())["add_color_picker3"].parse(args, kwargs, __FUNCTION__, &name, &default_value,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_color_picker3"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value,
 			&callback, &callback_data, &tip, &parent, &before, &source, &width, &height, &label, &popup, &show, 
 			&no_alpha, &no_small_preview, &no_inputs, &no_tooltip, &no_label, &no_side_preview, &alpha_bar,
 			&alpha_preview, &alpha_preview_half, &display_rgb, &display_hsv, &display_hex, &uint8, &floats, &picker_hue_bar,
@@ -1366,7 +1412,9 @@ namespace Marvel {
 		int input_rgb = false;
 		int input_hsv = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_color_picker4"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_color_picker4"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&default_value, &callback, &callback_data, &tip, &parent, &before, &source, &width, &height,
 			&label, &popup, &show, &no_alpha, &no_small_preview, &no_inputs, &no_tooltip, &no_label, &no_side_preview, &alpha_bar, 
 			&alpha_preview,	&alpha_preview_half, &display_rgb, &display_hsv, &display_hex, &uint8, &floats, &picker_hue_bar, 
@@ -1408,7 +1456,9 @@ namespace Marvel {
 		int no_border = false;
 		int no_drag_drop = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_color_button"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_color_button"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&name, &color, &callback, &callback_data, &tip, &parent, &before, &width, &height,
 			&popup, &show, &no_alpha, &no_border, &no_drag_drop))
 			return ToPyBool(false);
@@ -1443,7 +1493,9 @@ namespace Marvel {
 		int show = true;
 		int enabled = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_checkbox"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_checkbox"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&default_value, &callback, &callback_data, &tip, &parent, &before, &source,
 			&label, &popup, &show, &enabled))
 			return ToPyBool(false);
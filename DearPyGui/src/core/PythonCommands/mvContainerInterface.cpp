@@ -349,7 +349,9 @@ namespace Marvel {
 		const char* parent = "";
 		const char* before = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["add_menu_bar"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_menu_bar"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&show, &parent, &before))
 			return ToPyBool(false);
 
@@ -410,7 +412,9 @@ namespace Marvel {
 		const char* before = "";
 		int enabled = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_menu"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_menu"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&label, &show, &parent, &before, &enabled))
 			return ToPyBool(false);
 
@@ -441,7 +445,9 @@ namespace Marvel {
 		const char* parent = "";
 		const char* before = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["add_menu_item"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_menu_item"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&shortcut, &check, &callback, &callback_data, &label, &show, &enabled, &parent, &before))
 			return ToPyBool(false);
 
@@ -469,7 +475,9 @@ namespace Marvel {
 		const char* parent = "";
 		const char* before = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["add_tab_bar"].parse(args, kwargs, __FUNCTION__, &name, &reorderable,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_tab_bar"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &reorderable,
 			&callback, &callback_data, &show, &parent, &before))
 			return ToPyBool(false);
 
@@ -511,7 +519,9 @@ namespace Marvel {
 		const char* parent = "";
 		const char* before = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["add_tab"].parse(args, kwargs, __FUNCTION__, &name, &closeable,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_tab"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &closeable,
 			&label, &show, &no_reorder, &leading, &trailing, &no_tooltip, &tip, &parent, &before))
 			return ToPyBool(false);
 
@@ -590,7 +600,9 @@ namespace Marvel {
 		const char* parent = "";
 		const char* before = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["add_tab_button"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_tab_button"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&label, &show, &no_reorder, &leading, &trailing, &no_tooltip, &tip, &callback,
 			&callback_data, &parent, &before))
 			return ToPyBool(false);
@@ -675,7 +687,9 @@ namespace Marvel {
 		float horizontal_spacing = -1.0f;
 		const char* popup = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["add_group"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_group"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&show, &tip, &parent, &before, &width, &horizontal, &horizontal_spacing, &popup))
 			return ToPyBool(false);
 
@@ -713,7 +727,9 @@ namespace Marvel {
 		int horizontal_scrollbar = false;
 		int menubar = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_child"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_child"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&show, &tip, &parent, &before, &width, &height, &border, &popup, &autosize_x, 
 			&autosize_y, &no_scrollbar, &horizontal_scrollbar, &menubar))
 			return ToPyBool(false);
@@ -741,7 +757,9 @@ namespace Marvel {
 		const char* before = "";
 		
 
-		if (!(*mvApp::GetApp()->getParsers())["add_managed_columns"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_managed_columns"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&name, &columns, &border, &show, &parent, &before))
 			return ToPyBool(false);
 
@@ -768,7 +786,9 @@ namespace Marvel {
 		const char* before = "";
 
 
-		if (!(*mvApp::GetApp()->getParsers())["add_columns"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_columns"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&name, &columns, &border, &show, &parent, &before))
 			return ToPyBool(false);
 
@@ -791,7 +811,9 @@ namespace Marvel {
 		const char* parent = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_next_column"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_next_column"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&name, &show, &parent, &before))
 			return ToPyBool(false);
 
@@ -831,7 +853,9 @@ namespace Marvel {
 
 		//ImGuiWindowFlags flags = ImGuiWindowFlags_NoSavedSettings;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_window"].parse(args, kwargs, __FUNCTION__, &name, &width,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_window"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &width,
 			&height, &x_pos, &y_pos, &autosize, &no_resize, &no_title_bar, &no_move, &no_scrollbar, 
 			&no_collapse, &horizontal_scrollbar, &no_focus_on_appearing, &no_bring_to_front_on_focus, &menubar,
 			&noclose, &no_background, &label, &show, &closing_callback))
@@ -881,7 +905,9 @@ namespace Marvel {
 		const char* label = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_about_window"].parse(args, kwargs, __FUNCTION__, &name, &width,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_about_window"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &width,
 			&height, &x_pos, &y_pos, &autosize, &no_resize, &no_title_bar, &no_move, &no_scrollbar,
 			&no_collapse, &horizontal_scrollbar, &no_focus_on_appearing, &no_bring_to_front_on_focus,
 			&noclose, &no_background, &label, &show))
@@ -928,7 +954,9 @@ namespace Marvel {
 		const char* label = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_doc_window"].parse(args, kwargs, __FUNCTION__, &name, &width,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_doc_window"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &width,
 			&height, &x_pos, &y_pos, &autosize, &no_resize, &no_title_bar, &no_move, &no_scrollbar,
 			&no_collapse, &horizontal_scrollbar, &no_focus_on_appearing, &no_bring_to_front_on_focus,
 			&noclose, &no_background, &label, &show))
@@ -975,7 +1003,9 @@ namespace Marvel {
 		const char* label = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_debug_window"].parse(args, kwargs, __FUNCTION__, &name, &width,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_debug_window"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &width,
 			&height, &x_pos, &y_pos, &autosize, &no_resize, &no_title_bar, &no_move, &no_scrollbar,
 			&no_collapse, &horizontal_scrollbar, &no_focus_on_appearing, &no_bring_to_front_on_focus,
 			&noclose, &no_background, &label, &show))
@@ -1022,7 +1052,9 @@ namespace Marvel {
 		const char* label = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_style_window"].parse(args, kwargs, __FUNCTION__, &name, &width,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_style_window"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &width,
 			&height, &x_pos, &y_pos, &autosize, &no_resize, &no_title_bar, &no_move, &no_scrollbar,
 			&no_collapse, &horizontal_scrollbar, &no_focus_on_appearing, &no_bring_to_front_on_focus,
 			&noclose, &no_background, &label, &show))
@@ -1069,7 +1101,9 @@ namespace Marvel {
 		const char* label = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_metrics_window"].parse(args, kwargs, __FUNCTION__, &name, &width,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_metrics_window"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &width,
 			&height, &x_pos, &y_pos, &autosize, &no_resize, &no_title_bar, &no_move, &no_scrollbar,
 			&no_collapse, &horizontal_scrollbar, &no_focus_on_appearing, &no_bring_to_front_on_focus,
 			&noclose, &no_background, &label, &show))
@@ -1102,7 +1136,9 @@ namespace Marvel {
 		const char* before = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_tooltip"].parse(args, kwargs, __FUNCTION__, &tipparent,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_tooltip"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &tipparent,
 			&name, &parent, &before, &show))
 			return ToPyBool(false);
 
@@ -1132,7 +1168,9 @@ namespace Marvel {
 		int height = 0;
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_popup"].parse(args, kwargs, __FUNCTION__, &popupparent,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_popup"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &popupparent,
 			&name, &mousebutton, &modal, &parent, &before, &width, &height, &show))
 			return ToPyBool(false);
 
@@ -1174,7 +1212,9 @@ namespace Marvel {
 		int bullet = false;
 
 
-		if (!(*mvApp::GetApp()->getParsers())["add_collapsing_header"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_collapsing_header"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&label, &show, &tip, &parent, &before, &closable, &default_open, &open_on_double_click, &open_on_arrow, &leaf, &bullet))
 			return ToPyBool(false);
 
@@ -1205,7 +1245,9 @@ namespace Marvel {
 		int leaf = false;
 		int bullet = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_tree_node"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_tree_node"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&label, &show, &tip, &parent, &before, &default_open, &open_on_double_click, &open_on_arrow, &leaf, &bullet))
 			return ToPyBool(false);
 
@@ -211,7 +211,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_drag_float"].parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_drag_float"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enable, &width, &no_input, &clamped,
 			&label, &popup, &show))
 			return ToPyBool(false);
@@ -256,7 +258,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_drag_float2"].parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_drag_float2"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enable, &width, &no_input, &clamped,
 			&label, &popup, &show))
 			return ToPyBool(false);
@@ -303,7 +307,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_drag_float3"].parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_drag_float3"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enable, &width, &no_input, &clamped,
 			&label, &popup, &show))
 			return ToPyBool(false);
@@ -351,7 +357,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_drag_float4"].parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_drag_float4"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enable, &width, &no_input, &clamped,
 			&label, &popup, &show))
 			return ToPyBool(false);
@@ -396,7 +404,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_drag_int"].parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_drag_int"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enable, &width, &no_input, &clamped,
 			&label, &popup, &show))
 			return ToPyBool(false);
@@ -441,7 +451,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_drag_int2"].parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_drag_int2"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enable, &width, &no_input, &clamped,
 			&label, &popup, &show))
 			return ToPyBool(false);
@@ -488,7 +500,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_drag_int3"].parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_drag_int3"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enable, &width, &no_input, &clamped,
 			&label, &popup, &show))
 			return ToPyBool(false);
@@ -536,7 +550,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_drag_int4"].parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_drag_int4"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value, &speed,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enable, &width, &no_input, &clamped,
 			&label, &popup, &show))
 			return ToPyBool(false);
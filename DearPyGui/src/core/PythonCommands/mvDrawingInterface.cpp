@@ -229,7 +229,9 @@ namespace Marvel {
 		float scalex = 1.0f;
 		float scaley = 1.0f;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_drawing"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_drawing"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&name, &tip, &parent, &before, &width, &height, &popup, &show, &originx, &originy, &scalex, &scaley))
 			return ToPyBool(false);
 
@@ -269,7 +271,9 @@ namespace Marvel {
 		const char* drawing;
 		const char* tag;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_draw_command"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_draw_command"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&drawing, &tag))
 			return GetPyNone();
 
@@ -294,7 +298,9 @@ namespace Marvel {
 		const char* drawing;
 		const char* tag;
 
-		if (!(*mvApp::GetApp()->getParsers())["bring_draw_command_forward"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["bring_draw_command_forward"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&drawing, &tag))
 			return GetPyNone();
 
@@ -310,7 +316,9 @@ namespace Marvel {
 		const char* drawing;
 		const char* tag;
 
-		if (!(*mvApp::GetApp()->getParsers())["bring_draw_command_to_front"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["bring_draw_command_to_front"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&drawing, &tag))
 			return GetPyNone();
 
@@ -326,7 +334,9 @@ namespace Marvel {
 		const char* drawing;
 		const char* tag;
 
-		if (!(*mvApp::GetApp()->getParsers())["send_draw_command_back"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["send_draw_command_back"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&drawing, &tag))
 			return GetPyNone();
 
@@ -342,7 +352,9 @@ namespace Marvel {
 		const char* drawing;
 		const char* tag;
 
-		if (!(*mvApp::GetApp()->getParsers())["send_draw_command_to_back"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["send_draw_command_to_back"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&drawing, &tag))
 			return GetPyNone();
 
@@ -358,7 +370,9 @@ namespace Marvel {
 		const char* drawing;
 		const char* tag;
 
-		if (!(*mvApp::GetApp()->getParsers())["delete_draw_command"].parse(args, kwargs, __FUNCTION__, &drawing, &tag))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["delete_draw_command"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &drawing, &tag))
 			return GetPyNone();
 
 		mvDrawList* drawlist = GetDrawListFromTarget(drawing);
@@ -389,7 +403,9 @@ namespace Marvel {
 		PyTuple_SetItem(color, 3, PyFloat_FromDouble(255));
 		const char* tag = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["draw_image"].parse(args, kwargs, __FUNCTION__, &drawing, &file,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["draw_image"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &drawing, &file,
 			&pmin, &pmax, &uv_min, &uv_max, &color, &tag))
 			return GetPyNone();
 
@@ -423,7 +439,9 @@ namespace Marvel {
 		PyObject* color;
 		const char* tag = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["draw_line"].parse(args, kwargs, __FUNCTION__, &drawing, &p1, &p2, &color, &thickness, &tag))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["draw_line"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &drawing, &p1, &p2, &color, &thickness, &tag))
 			return GetPyNone();
 
 		mvVec2 mp1 = ToVec2(p1);
@@ -455,7 +473,9 @@ namespace Marvel {
 		PyObject* color;
 		const char* tag = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["draw_arrow"].parse(args, kwargs, __FUNCTION__, &drawing, &p1, &p2, &color, &thickness, &size, &tag))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["draw_arrow"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &drawing, &p1, &p2, &color, &thickness, &size, &tag))
 			return GetPyNone();
 
 		mvVec2 mp1 = ToVec2(p1);
@@ -486,7 +506,9 @@ namespace Marvel {
 		PyObject* fill = nullptr;
 		const char* tag = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["draw_triangle"].parse(args, kwargs, __FUNCTION__, &drawing, &p1, &p2, &p3, &color, &fill, &thickness, &tag))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["draw_triangle"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &drawing, &p1, &p2, &p3, &color, &fill, &thickness, &tag))
 			return GetPyNone();
 
 
@@ -520,7 +542,9 @@ namespace Marvel {
 		PyObject* fill = nullptr;
 		const char* tag = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["draw_rectangle"].parse(args, kwargs, __FUNCTION__, &drawing, &pmin, &pmax, &color, &fill, &rounding, &thickness, &tag))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["draw_rectangle"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &drawing, &pmin, &pmax, &color, &fill, &rounding, &thickness, &tag))
 			return GetPyNone();
 
 
@@ -553,7 +577,9 @@ namespace Marvel {
 		PyObject* fill = nullptr;
 		const char* tag = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["draw_quad"].parse(args, kwargs, __FUNCTION__, &drawing, &p1, &p2, &p3, &p4, &color, &fill, &thickness, &tag))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["draw_quad"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &drawing, &p1, &p2, &p3, &p4, &color, &fill, &thickness, &tag))
 			return GetPyNone();
 
 
@@ -588,7 +614,9 @@ namespace Marvel {
 		PyObject* color = nullptr;
 		const char* tag = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["draw_text"].parse(args, kwargs, __FUNCTION__, &drawing, &pos, &text, &color, &size, &tag))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["draw_text"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &drawing, &pos, &text, &color, &size, &tag))
 			return GetPyNone();
 
 		mvVec2 mpos = ToVec2(pos);
@@ -620,7 +648,9 @@ namespace Marvel {
 		PyObject* fill = nullptr;
 		const char* tag = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["draw_circle"].parse(args, kwargs, __FUNCTION__, &drawing, &center, &radius, &color, &segments, &thickness, &fill, &tag))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["draw_circle"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &drawing, &center, &radius, &color, &segments, &thickness, &fill, &tag))
 			return GetPyNone();
 
 		mvVec2 mcenter = ToVec2(center);
@@ -651,7 +681,9 @@ namespace Marvel {
 		float thickness = 1.0f;
 		const char* tag = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["draw_polyline"].parse(args, kwargs, __FUNCTION__, &drawing, &points, &color, &closed, &thickness, &tag))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["draw_polyline"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &drawing, &points, &color, &closed, &thickness, &tag))
 			return GetPyNone();
 
 		auto mpoints = ToVectVec2(points);
@@ -681,7 +713,9 @@ namespace Marvel {
 		float thickness = 1.0f;
 		const char* tag = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["draw_polygon"].parse(args, kwargs, __FUNCTION__, &drawing, &points, &color, &fill, &thickness, &tag))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["draw_polygon"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &drawing, &points, &color, &fill, &thickness, &tag))
 			return GetPyNone();
 
 		auto mpoints = ToVectVec2(points);
@@ -712,7 +746,9 @@ namespace Marvel {
 		int segments = 0;
 		const char* tag = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["draw_bezier_curve"].parse(args, kwargs, __FUNCTION__, &drawing, &p1, &p2, &p3, &p4, &color, &thickness, &segments, &tag))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["draw_bezier_curve"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &drawing, &p1, &p2, &p3, &p4, &color, &thickness, &segments, &tag))
 			return GetPyNone();
 
 		mvVec2 mp1 = ToVec2(p1);
@@ -740,7 +776,9 @@ namespace Marvel {
 	{
 		const char* drawing;
 
-		if (!(*mvApp::GetApp()->getParsers())["clear_drawing"].parse(args, kwargs, __FUNCTION__, &drawing))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["clear_drawing"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &drawing))
 			return GetPyNone();
 
 		mvDrawList* drawlist = GetDrawListFromTarget(drawing);
@@ -101,11 +101,13 @@ namespace Marvel {
 		}, "Sets a callback for a key release event.", "None", "Input Polling") });
 	}
 
-	PyObject* get_mouse_pos(PyObject* self, PyObject* args, PyObject* kwargs)
+	PyObject* get_mouse_pos(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
 	{
 		int local = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_mouse_pos"].parse(args, kwargs, __FUNCTION__, &local))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_mouse_pos"];
+
+		if (!parser.parseFast(args, nargs, kwnames, __FUNCTION__, &local))
 			return GetPyNone();
 
 		mvVec2 pos = mvInput::getMousePosition();
@@ -119,7 +121,9 @@ namespace Marvel {
 	{
 		int local = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_plot_mouse_pos"].parse(args, kwargs, __FUNCTION__, &local))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_plot_mouse_pos"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &local))
 			return GetPyNone();
 
 		mvVec2 pos = mvInput::getPlotMousePosition();
@@ -134,11 +138,13 @@ namespace Marvel {
 		return pvalue;
 	}
 
-	PyObject* is_key_pressed(PyObject* self, PyObject* args, PyObject* kwargs)
+	PyObject* is_key_pressed(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
 	{
 		int key;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_key_pressed"].parse(args, kwargs, __FUNCTION__, &key))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_key_pressed"];
+
+		if (!parser.parseFast(args, nargs, kwnames, __FUNCTION__, &key))
 			return GetPyNone();
 
 		bool pressed = mvInput::isKeyPressed(key);
@@ -152,7 +158,9 @@ namespace Marvel {
 	{
 		int key;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_key_released"].parse(args, kwargs, __FUNCTION__, &key))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_key_released"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &key))
 			return GetPyNone();
 
 		bool pressed = mvInput::isKeyReleased(key);
@@ -162,11 +170,13 @@ namespace Marvel {
 		return pvalue;
 	}
 
-	PyObject* is_key_down(PyObject* self, PyObject* args, PyObject* kwargs)
+	PyObject* is_key_down(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
 	{
 		int key;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_key_down"].parse(args, kwargs, __FUNCTION__, &key))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_key_down"];
+
+		if (!parser.parseFast(args, nargs, kwnames, __FUNCTION__, &key))
 			return GetPyNone();
 
 		bool pressed = mvInput::isKeyDown(key);
@@ -181,17 +191,21 @@ namespace Marvel {
 		int button;
 		float threshold;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_mouse_button_dragging"].parse(args, kwargs, __FUNCTION__, &button, &threshold))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_mouse_button_dragging"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &button, &threshold))
 			return GetPyNone();
 
 		return ToPyBool(mvInput::isMouseDragging(button, threshold));
 	}
 
-	PyObject* is_mouse_button_down(PyObject* self, PyObject* args, PyObject* kwargs)
+	PyObject* is_mouse_button_down(PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames)
 	{
 		int button;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_mouse_button_down"].parse(args, kwargs, __FUNCTION__, &button))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_mouse_button_down"];
+
+		if (!parser.parseFast(args, nargs, kwnames, __FUNCTION__, &button))
 			return GetPyNone();
 
 		return ToPyBool(mvInput::isMouseButtonDown(button));
@@ -201,7 +215,9 @@ namespace Marvel {
 	{
 		int button;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_mouse_button_clicked"].parse(args, kwargs, __FUNCTION__, &button))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_mouse_button_clicked"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &button))
 			return GetPyNone();
 
 		return ToPyBool(mvInput::isMouseButtonClicked(button));
@@ -211,7 +227,9 @@ namespace Marvel {
 	{
 		int button;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_mouse_button_double_clicked"].parse(args, kwargs, __FUNCTION__, &button))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_mouse_button_double_clicked"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &button))
 			return GetPyNone();
 
 		return ToPyBool(mvInput::isMouseButtonDoubleClicked(button));
@@ -221,7 +239,9 @@ namespace Marvel {
 	{
 		int button;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_mouse_button_released"].parse(args, kwargs, __FUNCTION__, &button))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_mouse_button_released"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &button))
 			return GetPyNone();
 
 		return ToPyBool(mvInput::isMouseButtonReleased(button));
@@ -231,7 +251,9 @@ namespace Marvel {
 	{
 		PyObject* callback;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_mouse_down_callback"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_mouse_down_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&callback))
 			return GetPyNone();
 
@@ -248,7 +270,9 @@ namespace Marvel {
 		PyObject* callback;
 		float threshold;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_mouse_drag_callback"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_mouse_drag_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&callback, &threshold))
 			return GetPyNone();
 
@@ -265,7 +289,9 @@ namespace Marvel {
 	{
 		PyObject* callback;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_mouse_double_click_callback"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_mouse_double_click_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&callback))
 			return GetPyNone();
 
@@ -280,7 +306,9 @@ namespace Marvel {
 	{
 		PyObject* callback;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_mouse_click_callback"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_mouse_click_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&callback))
 			return GetPyNone();
 		if (callback)
@@ -293,7 +321,9 @@ namespace Marvel {
 	{
 		PyObject* callback;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_mouse_release_callback"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_mouse_release_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&callback))
 			return GetPyNone();
 		if (callback)
@@ -307,7 +337,9 @@ namespace Marvel {
 	{
 		PyObject* callback;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_key_down_callback"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_key_down_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&callback))
 			return GetPyNone();
 		if (callback)
@@ -321,7 +353,9 @@ namespace Marvel {
 	{
 		PyObject* callback;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_key_press_callback"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_key_press_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&callback))
 			return GetPyNone();
 		if (callback)
@@ -335,7 +369,9 @@ namespace Marvel {
 	{
 		PyObject* callback;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_key_release_callback"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_key_release_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&callback))
 			return GetPyNone();
 		if (callback)
@@ -348,7 +384,9 @@ namespace Marvel {
 	{
 		PyObject* callback;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_mouse_wheel_callback"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_mouse_wheel_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&callback))
 			return GetPyNone();
 		if (callback)
@@ -362,7 +400,9 @@ namespace Marvel {
 	{
 		PyObject* callback;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_mouse_move_callback"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_mouse_move_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&callback))
 			return GetPyNone();
 		if (callback)
@@ -376,7 +416,9 @@ namespace Marvel {
 	{
 		PyObject* callback = nullptr;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_render_callback"].parse(args, kwargs, __FUNCTION__, &callback))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_render_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &callback))
 			return GetPyNone();
 		if (callback)
 			Py_XINCREF(callback);
@@ -389,7 +431,9 @@ namespace Marvel {
 		PyObject* callback = nullptr;
 		const char* handler = "MainWindow";
 
-		if (!(*mvApp::GetApp()->getParsers())["set_resize_callback"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_resize_callback"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&callback, &handler))
 			return GetPyNone();
 		if (callback)
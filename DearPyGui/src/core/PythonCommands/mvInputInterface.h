@@ -7,11 +7,11 @@ namespace Marvel {
 
 	// mouse polling
 	PyObject* is_mouse_button_dragging       (PyObject* self, PyObject* args, PyObject* kwargs);
-	PyObject* is_mouse_button_down           (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* is_mouse_button_down           (PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames);
 	PyObject* is_mouse_button_clicked        (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* is_mouse_button_double_clicked (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* is_mouse_button_released       (PyObject* self, PyObject* args, PyObject* kwargs);
-	PyObject* get_mouse_pos                  (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* get_mouse_pos                  (PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames);
 	PyObject* get_plot_mouse_pos             (PyObject* self, PyObject* args, PyObject* kwargs);
 	PyObject* get_mouse_drag_delta           (PyObject* self, PyObject* args);
 
@@ -25,9 +25,9 @@ namespace Marvel {
 	PyObject* set_mouse_move_callback        (PyObject* self, PyObject* args, PyObject* kwargs);
 
 	// key polling
-	PyObject* is_key_pressed                 (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* is_key_pressed                 (PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames);
 	PyObject* is_key_released                (PyObject* self, PyObject* args, PyObject* kwargs);
-	PyObject* is_key_down                    (PyObject* self, PyObject* args, PyObject* kwargs);
+	PyObject* is_key_down                    (PyObject* self, PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames);
 
 	// key callbacks
 	PyObject* set_key_down_callback          (PyObject* self, PyObject* args, PyObject* kwargs);
@@ -222,7 +222,9 @@ namespace Marvel {
 
 		//int flags = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_input_text"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_input_text"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&name, &default_value, &hint, &multiline, &no_spaces,
 			&uppercase, &decimal, &hexadecimal, &readonly, &password, &scientific, &callback, 
 			&callback_data, &tip, &parent, &before, &source, &enabled, &width, &height, &on_enter,
@@ -266,7 +268,9 @@ namespace Marvel {
 		int step_fast = 100;
 		int readonly = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_input_int"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_input_int"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&default_value, &callback, &callback_data, &tip, &parent, &before, &source, &enabled, &width, &on_enter,
 			&label, &popup, &show, &step, &step_fast, &readonly))
 			return ToPyBool(false);
@@ -307,7 +311,9 @@ namespace Marvel {
 		int show = false;
 		int readonly = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_input_int2"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_input_int2"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&default_value, &callback, &callback_data, &tip, &parent, &before, &source, &enabled, &width, &on_enter,
 			&label, &popup, &show, &readonly))
 			return ToPyBool(false);
@@ -351,7 +357,9 @@ namespace Marvel {
 		int show = false;
 		int readonly = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_input_int3"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_input_int3"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&default_value, &callback, &callback_data, &tip, &parent, &before, &source, &enabled, &width, &on_enter,
 			&label, &popup, &show, &readonly))
 			return ToPyBool(false);
@@ -396,7 +404,9 @@ namespace Marvel {
 		int show = false;
 		int readonly = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_input_int4"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_input_int4"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&default_value, &callback, &callback_data, &tip, &parent, &before, &source, &enabled, &width, &on_enter,
 			&label, &popup, &show, &readonly))
 			return ToPyBool(false);
@@ -439,7 +449,9 @@ namespace Marvel {
 		float step_fast = 1.0f;
 		int readonly = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_input_float"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_input_float"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&default_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enabled, &width, &on_enter,
 			&label, &popup, &show, &step, &step_fast, &readonly))
 			return ToPyBool(false);
@@ -481,7 +493,9 @@ namespace Marvel {
 		int show = false;
 		int readonly = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_input_float2"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_input_float2"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&default_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enabled, &width, &on_enter,
 			&label, &popup, &show, &readonly))
 			return ToPyBool(false);
@@ -525,7 +539,9 @@ namespace Marvel {
 		int show = false;
 		int readonly = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_input_float3"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_input_float3"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&default_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enabled, &width, &on_enter,
 			&label, &popup, &show, &readonly))
 			return ToPyBool(false);
@@ -571,7 +587,9 @@ namespace Marvel {
 		int show = false;
 		int readonly = false;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_input_float4"].parse(args, kwargs, __FUNCTION__, &name,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_input_float4"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name,
 			&default_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enabled, &width, &on_enter,
 			&label, &popup, &show, &readonly))
 			return ToPyBool(false);
@@ -448,7 +448,9 @@ namespace Marvel {
 		int clamped = true;
 		const char* tag = "";
 
-		if (!(*mvApp::GetApp()->getParsers())["add_annotation"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_annotation"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&plot, &text, &x, &y, &xoffset, &yoffset, &color, &clamped, &tag))
 			return GetPyNone();
 
@@ -489,7 +491,9 @@ namespace Marvel {
 		PyObject* callback = nullptr;
 		float default_value = 0.0f;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_drag_line"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_drag_line"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&plot, &name, &source, &color, &thickness, &y_line, &show_label, &callback, &default_value))
 			return GetPyNone();
 
@@ -533,7 +537,9 @@ namespace Marvel {
 		float default_x = 0.0f;
 		float default_y = 0.0f;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_drag_point"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_drag_point"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&plot, &name, &source, &color, &radius, &show_label, &callback, &default_x, &default_y))
 			return GetPyNone();
 
@@ -566,7 +572,9 @@ namespace Marvel {
 	{
 		const char* plot;
 
-		if (!(*mvApp::GetApp()->getParsers())["clear_plot"].parse(args, kwargs, __FUNCTION__, &plot))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["clear_plot"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -595,7 +603,9 @@ namespace Marvel {
 	{
 		const char* plot;
 
-		if (!(*mvApp::GetApp()->getParsers())["reset_xticks"].parse(args, kwargs, __FUNCTION__, &plot))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["reset_xticks"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -624,7 +634,9 @@ namespace Marvel {
 	{
 		const char* plot;
 
-		if (!(*mvApp::GetApp()->getParsers())["reset_yticks"].parse(args, kwargs, __FUNCTION__, &plot))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["reset_yticks"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -654,7 +666,9 @@ namespace Marvel {
 		const char* plot;
 		PyObject* label_pairs;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_xticks"].parse(args, kwargs, __FUNCTION__, &plot, &label_pairs))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_xticks"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot, &label_pairs))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -695,7 +709,9 @@ namespace Marvel {
 		const char* plot;
 		PyObject* label_pairs;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_yticks"].parse(args, kwargs, __FUNCTION__, &plot, &label_pairs))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_yticks"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot, &label_pairs))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -735,7 +751,9 @@ namespace Marvel {
 	{
 		const char* plot;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_plot_xlimits_auto"].parse(args, kwargs, __FUNCTION__, &plot))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_plot_xlimits_auto"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -763,7 +781,9 @@ namespace Marvel {
 	{
 		const char* plot;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_plot_ylimits_auto"].parse(args, kwargs, __FUNCTION__, &plot))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_plot_ylimits_auto"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -794,7 +814,9 @@ namespace Marvel {
 		float xmin;
 		float xmax;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_plot_xlimits"].parse(args, kwargs, __FUNCTION__, &plot, &xmin, &xmax))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_plot_xlimits"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot, &xmin, &xmax))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -825,7 +847,9 @@ namespace Marvel {
 		float ymin;
 		float ymax;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_plot_ylimits"].parse(args, kwargs, __FUNCTION__, &plot, &ymin, &ymax))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_plot_ylimits"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot, &ymin, &ymax))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -853,7 +877,9 @@ namespace Marvel {
 	{
 		const char* plot;
 
-		if (!(*mvApp::GetApp()->getParsers())["is_plot_queried"].parse(args, kwargs, __FUNCTION__, &plot))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["is_plot_queried"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -879,7 +905,9 @@ namespace Marvel {
 	{
 		const char* plot;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_plot_xlimits"].parse(args, kwargs, __FUNCTION__, &plot))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_plot_xlimits"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -907,7 +935,9 @@ namespace Marvel {
 	{
 		const char* plot;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_plot_ylimits"].parse(args, kwargs, __FUNCTION__, &plot))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_plot_ylimits"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -935,7 +965,9 @@ namespace Marvel {
 	{
 		const char* plot;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_plot_query_area"].parse(args, kwargs, __FUNCTION__, &plot))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_plot_query_area"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -964,7 +996,9 @@ namespace Marvel {
 		const char* plot;
 		int map;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_color_map"].parse(args, kwargs, __FUNCTION__, &plot, &map))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_color_map"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot, &map))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -1062,7 +1096,9 @@ namespace Marvel {
 		int show_drag_lines = true;
 		int show_drag_points = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_plot"].parse(args, kwargs, __FUNCTION__, &name, &xAxisName, &yAxisName,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_plot"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &xAxisName, &yAxisName,
 			&no_legend, &no_menus, &no_box_select, &no_mouse_pos, &no_highlight, &no_child, &query, &crosshairs, &antialiased,
 			&yaxis2, &yaxis3,
 			&xaxis_no_gridlines,
@@ -1115,7 +1151,9 @@ namespace Marvel {
 		const char* plot;
 		const char* series;
 
-		if (!(*mvApp::GetApp()->getParsers())["delete_series"].parse(args, kwargs, __FUNCTION__, &plot, &series))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["delete_series"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot, &series))
 			return GetPyNone();
 
 		mvAppItem* aplot = mvApp::GetApp()->getItemRegistry().getItem(plot);
@@ -1144,7 +1182,9 @@ namespace Marvel {
 		const char* plot;
 		const char* name;
 
-		if (!(*mvApp::GetApp()->getParsers())["delete_annotation"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["delete_annotation"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&plot, &name))
 			return GetPyNone();
 
@@ -1174,7 +1214,9 @@ namespace Marvel {
 		const char* plot;
 		const char* name;
 
-		if (!(*mvApp::GetApp()->getParsers())["delete_drag_line"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["delete_drag_line"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&plot, &name))
 			return GetPyNone();
 
@@ -1204,7 +1246,9 @@ namespace Marvel {
 		const char* plot;
 		const char* name;
 
-		if (!(*mvApp::GetApp()->getParsers())["delete_drag_point"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["delete_drag_point"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&plot, &name))
 			return GetPyNone();
 
@@ -1253,7 +1297,9 @@ namespace Marvel {
 		int update_bounds = true;
 		int axis = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_image_series"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_image_series"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&plot, &name, &value, &bounds_min, &bounds_max, &uv_min, &uv_max, &tintcolor, &update_bounds, &axis))
 			return GetPyNone();
 
@@ -1309,7 +1355,9 @@ namespace Marvel {
 		int update_bounds = true;
 		int axis = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_pie_series"].parse(args, kwargs, __FUNCTION__, &plot, &name, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_pie_series"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot, &name, 
 			&values, &labels, &x,
 			&y, &radius, &normalize, &angle, &format, &update_bounds, &axis))
 			return GetPyNone();
@@ -1355,7 +1403,9 @@ namespace Marvel {
 		int update_bounds = true;
 		int axis = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_line_series"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_line_series"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&plot, &name, &x, &y, &color, &weight, &update_bounds, &axis))
 			return GetPyNone();
 
@@ -1397,7 +1447,9 @@ namespace Marvel {
 		int update_bounds = true;
 		int axis = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_stair_series"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_stair_series"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&plot, &name, &x, &y, &color, &weight, &update_bounds))
 			return GetPyNone();
 
@@ -1435,7 +1487,9 @@ namespace Marvel {
 		int update_bounds = true;
 		int axis = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_bar_series"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_bar_series"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&plot, &name, &x, &y, &weight, &horizontal, &update_bounds, &axis))
 			return GetPyNone();
 
@@ -1485,7 +1539,9 @@ namespace Marvel {
 		int update_bounds = true;
 		int axis = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_shade_series"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_shade_series"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&plot, &name, &x, &y1, &y2, &color, &fill, &weight, &update_bounds, &axis))
 			return GetPyNone();
 
@@ -1550,7 +1606,9 @@ namespace Marvel {
 		int update_bounds = true;
 		int axis = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_candle_series"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_candle_series"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&plot, &name, &dates, &opens, &highs, &lows, &closes, &tooltip, 
 			&bull_color, &bear_color, &weight, &update_bounds, &axis))
 			return GetPyNone();
@@ -1611,7 +1669,9 @@ namespace Marvel {
 		int xy_data_format = false;
 		int axis = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_scatter_series"].parse(args, kwargs, __FUNCTION__, &plot, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_scatter_series"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot, 
 			&name, &x, &y, &marker,
 			&size, &weight, &outline, &fill, &update_bounds, &xy_data_format, &axis))
 			return GetPyNone();
@@ -1661,7 +1721,9 @@ namespace Marvel {
 		int update_bounds = true;
 		int axis = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_stem_series"].parse(args, kwargs, __FUNCTION__, &plot, &name, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_stem_series"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &plot, &name, 
 			&x, &y, &marker,
 			&size, &weight, &outline, &fill, &update_bounds, (ImPlotYAxis_)axis))
 			return GetPyNone();
@@ -1703,7 +1765,9 @@ namespace Marvel {
 		int update_bounds = true;
 		int axis = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_text_point"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_text_point"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&plot, &name, &x, &y, &vertical, &xoffset, &yoffset, &update_bounds, &axis))
 			return GetPyNone();
 
@@ -1744,7 +1808,9 @@ namespace Marvel {
 		int update_bounds = true;
 		int axis = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_area_series"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_area_series"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&plot, &name, &x, &y, &color, &fill, &weight, &update_bounds, &axis))
 			return GetPyNone();
 
@@ -1797,7 +1863,9 @@ namespace Marvel {
 		PyTuple_SetItem(color, 3, PyLong_FromLong(255));
 		int axis = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_error_series"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_error_series"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&plot, &name, &x, &y, &negative, &positive, &horizontal, &update_bounds, &color, &axis))
 			return GetPyNone();
 
@@ -1848,7 +1916,9 @@ namespace Marvel {
 		int update_bounds = true;
 		int axis = 0;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_heat_series"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_heat_series"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&plot, &name, &values, &rows, &columns, &scale_min, &scale_max, &format, 
 			&bounds_min, &bounds_max, &update_bounds, &axis))
 			return GetPyNone();
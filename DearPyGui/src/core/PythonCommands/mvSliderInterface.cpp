@@ -208,7 +208,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_slider_float"].parse(args, kwargs, __FUNCTION__, &name, &default_value,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_slider_float"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value,
 			&min_value, &max_value, &format, &vertical, &callback, &callback_data, &tip, &parent, &before,
 			&source, &enabled, &width, &height, &no_input, &clamped, &label, &popup, &show))
 			return ToPyBool(false);
@@ -252,7 +254,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_slider_float2"].parse(args, kwargs, __FUNCTION__, &name, &default_value,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_slider_float2"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enabled, &width,
 			&no_input, &clamped, &label, &popup, &show))
 			return ToPyBool(false);
@@ -300,7 +304,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_slider_float3"].parse(args, kwargs, __FUNCTION__, &name, &default_value,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_slider_float3"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enabled, &width,
 			&no_input, &clamped, &label, &popup, &show))
 			return ToPyBool(false);
@@ -348,7 +354,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_slider_float4"].parse(args, kwargs, __FUNCTION__, &name, &default_value,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_slider_float4"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enabled,
 			&width, &no_input, &clamped, &label, &popup, &show))
 			return ToPyBool(false);
@@ -393,7 +401,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_slider_int"].parse(args, kwargs, __FUNCTION__, &name, &default_value,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_slider_int"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value,
 			&min_value, &max_value, &format, &vertical, &callback, &callback_data, &tip, &parent, &before, &source, &enabled,
 			&width, &height, &no_input, &clamped, &label, &popup, &show))
 			return ToPyBool(false);
@@ -437,7 +447,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_slider_int2"].parse(args, kwargs, __FUNCTION__, &name, &default_value,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_slider_int2"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enabled,
 			&width, &no_input, &clamped, &label, &popup, &show))
 			return ToPyBool(false);
@@ -483,7 +495,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_slider_int3"].parse(args, kwargs, __FUNCTION__, &name, &default_value,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_slider_int3"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enabled,
 			&width, &no_input, &clamped, &label, &popup, &show))
 			return ToPyBool(false);
@@ -530,7 +544,9 @@ namespace Marvel {
 		const char* popup = "";
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_slider_int4"].parse(args, kwargs, __FUNCTION__, &name, &default_value,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_slider_int4"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &default_value,
 			&min_value, &max_value, &format, &callback, &callback_data, &tip, &parent, &before, &source, &enabled,
 			&width, &no_input, &clamped, &label, &popup, &show))
 			return ToPyBool(false);
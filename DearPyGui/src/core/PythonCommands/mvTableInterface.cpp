@@ -99,7 +99,9 @@ namespace Marvel{
 	{
 		const char* name;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_table_data"].parse(args, kwargs, __FUNCTION__, &name))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_table_data"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name))
 			return GetPyNone();
 
 		mvAppItem* item = mvApp::GetApp()->getItemRegistry().getItem(std::string(name));
@@ -126,7 +128,9 @@ namespace Marvel{
 		const char* name;
 		PyObject* value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_table_data"].parse(args, kwargs, __FUNCTION__, &name, &value))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_table_data"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &name, &value))
 			return GetPyNone();
 
 		mvAppItem* item = mvApp::GetApp()->getItemRegistry().getItem(std::string(name));
@@ -162,7 +166,9 @@ namespace Marvel{
 		int height = 0;
 		int show = true;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_table"].parse(args, kwargs, __FUNCTION__, 
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_table"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, 
 			&name, &headers, &callback, &callback_data, &parent,
 			&before, &width, &height, &show))
 			return ToPyBool(false);
@@ -187,7 +193,9 @@ namespace Marvel{
 		const char* table;
 		PyObject* headers;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_headers"].parse(args, kwargs, __FUNCTION__, &table, &headers))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_headers"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &table, &headers))
 			return GetPyNone();
 
 		mvAppItem* item = mvApp::GetApp()->getItemRegistry().getItem(table);
@@ -210,7 +218,9 @@ namespace Marvel{
 	{
 		const char* table;
 
-		if (!(*mvApp::GetApp()->getParsers())["clear_table"].parse(args, kwargs, __FUNCTION__, &table))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["clear_table"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &table))
 			return GetPyNone();
 
 		mvAppItem* item = mvApp::GetApp()->getItemRegistry().getItem(table);
@@ -239,7 +249,9 @@ namespace Marvel{
 		int row;
 		int column;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_table_item"].parse(args, kwargs, __FUNCTION__, &table, &row,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_table_item"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &table, &row,
 			&column))
 			return GetPyNone();
 
@@ -270,7 +282,9 @@ namespace Marvel{
 		int column;
 		const char* value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_table_item"].parse(args, kwargs, __FUNCTION__, &table, &row,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_table_item"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &table, &row,
 			&column, &value))
 			return GetPyNone();
 
@@ -299,7 +313,9 @@ namespace Marvel{
 	{
 		const char* table;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_table_selections"].parse(args, kwargs, __FUNCTION__, &table))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_table_selections"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &table))
 			return GetPyNone();
 
 		mvAppItem* item = mvApp::GetApp()->getItemRegistry().getItem(table);
@@ -328,7 +344,9 @@ namespace Marvel{
 		int column;
 		int value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_table_selection"].parse(args, kwargs, __FUNCTION__, &table, &row,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_table_selection"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &table, &row,
 			&column, &value))
 			return GetPyNone();
 
@@ -359,7 +377,9 @@ namespace Marvel{
 		const char* name;
 		PyObject* column;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_column"].parse(args, kwargs, __FUNCTION__, &table, &name, &column))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_column"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &table, &name, &column))
 			return GetPyNone();
 
 		mvAppItem* item = mvApp::GetApp()->getItemRegistry().getItem(table);
@@ -392,7 +412,9 @@ namespace Marvel{
 		const char* name;
 		PyObject* column;
 
-		if (!(*mvApp::GetApp()->getParsers())["insert_column"].parse(args, kwargs, __FUNCTION__, &table, &column_index, &name, &column))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["insert_column"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &table, &column_index, &name, &column))
 			return GetPyNone();
 
 		mvAppItem* item = mvApp::GetApp()->getItemRegistry().getItem(table);
@@ -423,7 +445,9 @@ namespace Marvel{
 		const char* table;
 		int column;
 
-		if (!(*mvApp::GetApp()->getParsers())["delete_column"].parse(args, kwargs, __FUNCTION__, &table, &column))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["delete_column"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &table, &column))
 			return GetPyNone();
 
 		mvAppItem* item = mvApp::GetApp()->getItemRegistry().getItem(table);
@@ -452,7 +476,9 @@ namespace Marvel{
 		const char* table;
 		PyObject* row;
 
-		if (!(*mvApp::GetApp()->getParsers())["add_row"].parse(args, kwargs, __FUNCTION__, &table, &row))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_row"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &table, &row))
 			return GetPyNone();
 
 		mvAppItem* item = mvApp::GetApp()->getItemRegistry().getItem(table);
@@ -490,7 +516,9 @@ namespace Marvel{
 		int row_index;
 		PyObject* row;
 
-		if (!(*mvApp::GetApp()->getParsers())["insert_row"].parse(args, kwargs, __FUNCTION__, &table, &row_index, &row))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["insert_row"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &table, &row_index, &row))
 			return GetPyNone();
 
 		mvAppItem* item = mvApp::GetApp()->getItemRegistry().getItem(table);
@@ -527,7 +555,9 @@ namespace Marvel{
 		const char* table;
 		int row;
 
-		if (!(*mvApp::GetApp()->getParsers())["delete_row"].parse(args, kwargs, __FUNCTION__, &table, &row))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["delete_row"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &table, &row))
 			return GetPyNone();
 
 		mvAppItem* item = mvApp::GetApp()->getItemRegistry().getItem(table);
@@ -284,7 +284,9 @@ namespace Marvel {
 	{
 		float scale;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_global_font_scale"].parse(args, kwargs, __FUNCTION__, &scale))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_global_font_scale"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &scale))
 			return GetPyNone();
 
 		mvApp::GetApp()->setGlobalFontScale(scale);
@@ -306,7 +308,9 @@ namespace Marvel {
 		PyObject* custom_glyph_chars = nullptr;
 
 
-		if (!(*mvApp::GetApp()->getParsers())["add_additional_font"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["add_additional_font"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&file, &size, &glyph_ranges, &custom_glyph_chars, &custom_glyph_ranges))
 			return GetPyNone();
 
@@ -330,7 +334,9 @@ namespace Marvel {
 	{
 		int item;
 
-		if (!(*mvApp::GetApp()->getParsers())["get_theme_item"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["get_theme_item"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		auto color = mvApp::GetApp()->getThemeItem(item);
@@ -348,7 +354,9 @@ namespace Marvel {
 		int item;
 		int r, g, b, a;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_theme_item"].parse(args, kwargs, __FUNCTION__, &item, &r, &g, &b, &a))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_theme_item"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item, &r, &g, &b, &a))
 			return GetPyNone();
 
 		mvApp::GetApp()->setThemeItem(item, { r, g, b, a });
@@ -362,7 +370,9 @@ namespace Marvel {
 		int style;
 		PyObject* color;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_item_color"].parse(args, kwargs, __FUNCTION__, &item, &style, &color))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_item_color"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item, &style, &color))
 			return GetPyNone();
 
 		auto mcolor = ToColor(color);
@@ -379,7 +389,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["clear_item_color"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["clear_item_color"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		mvAppItem* appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -396,7 +408,9 @@ namespace Marvel {
 		int style;
 		PyObject* value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_item_style_var"].parse(args, kwargs, __FUNCTION__, &item, &style, &value))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_item_style_var"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item, &style, &value))
 			return GetPyNone();
 
 		mvAppItem* appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -411,7 +425,9 @@ namespace Marvel {
 	{
 		const char* item;
 
-		if (!(*mvApp::GetApp()->getParsers())["clear_item_style_vars"].parse(args, kwargs, __FUNCTION__, &item))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["clear_item_style_vars"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &item))
 			return GetPyNone();
 
 		mvAppItem* appitem = mvApp::GetApp()->getItemRegistry().getItem(item);
@@ -426,7 +442,9 @@ namespace Marvel {
 	{
 		const char* theme;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_theme"].parse(args, kwargs, __FUNCTION__, &theme))
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_theme"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__, &theme))
 			return GetPyNone();
 
 		mvApp::GetApp()->setAppTheme(std::string(theme));
@@ -625,7 +643,9 @@ namespace Marvel {
 		float x;
 		float y;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_window_padding"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_window_padding"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&x, &y))
 			return GetPyNone();
 
@@ -641,7 +661,9 @@ namespace Marvel {
 		float x;
 		float y;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_frame_padding"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_frame_padding"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&x, &y))
 			return GetPyNone();
 
@@ -657,7 +679,9 @@ namespace Marvel {
 		float x;
 		float y;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_item_spacing"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_item_spacing"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&x, &y))
 			return GetPyNone();
 
@@ -673,7 +697,9 @@ namespace Marvel {
 		float x;
 		float y;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_item_inner_spacing"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_item_inner_spacing"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&x, &y))
 			return GetPyNone();
 
@@ -689,7 +715,9 @@ namespace Marvel {
 		float x;
 		float y;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_touch_extra_padding"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_touch_extra_padding"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&x, &y))
 			return GetPyNone();
 
@@ -704,7 +732,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_indent_spacing"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_indent_spacing"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -719,7 +749,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_scrollbar_size"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_scrollbar_size"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -734,7 +766,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_grab_min_size"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_grab_min_size"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -749,7 +783,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_window_border_size"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_window_border_size"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -764,7 +800,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_child_border_size"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_child_border_size"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -779,7 +817,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_popup_border_size"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_popup_border_size"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -794,7 +834,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_frame_border_size"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_frame_border_size"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -809,7 +851,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_tab_border_size"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_tab_border_size"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -824,7 +868,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_window_rounding"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_window_rounding"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -839,7 +885,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_child_rounding"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_child_rounding"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -854,7 +902,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_frame_rounding"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_frame_rounding"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -869,7 +919,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_popup_rounding"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_popup_rounding"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -884,7 +936,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_scrollbar_rounding"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_scrollbar_rounding"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -899,7 +953,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_grab_rounding"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_grab_rounding"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -914,7 +970,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_tab_rounding"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_tab_rounding"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -930,7 +988,9 @@ namespace Marvel {
 		float x;
 		float y;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_window_title_align"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_window_title_align"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&x, &y))
 			return GetPyNone();
 
@@ -945,7 +1005,9 @@ namespace Marvel {
 	{
 		int value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_window_menu_button_position"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_window_menu_button_position"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -960,7 +1022,9 @@ namespace Marvel {
 	{
 		int value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_color_button_position"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_color_button_position"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -976,7 +1040,9 @@ namespace Marvel {
 		float x;
 		float y;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_window_title_align"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_window_title_align"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&x, &y))
 			return GetPyNone();
 
@@ -992,7 +1058,9 @@ namespace Marvel {
 		float x;
 		float y;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_selectable_text_align"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_selectable_text_align"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&x, &y))
 			return GetPyNone();
 
@@ -1008,7 +1076,9 @@ namespace Marvel {
 		float x;
 		float y;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_display_safe_area_padding"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_display_safe_area_padding"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&x, &y))
 			return GetPyNone();
 
@@ -1023,7 +1093,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_global_alpha"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_global_alpha"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -1038,7 +1110,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_curve_tessellation_tolerance"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_curve_tessellation_tolerance"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -1053,7 +1127,9 @@ namespace Marvel {
 	{
 		float value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_circle_segment_max_error"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_circle_segment_max_error"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -1068,7 +1144,9 @@ namespace Marvel {
 	{
 		int value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_antialiased_lines"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_antialiased_lines"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
@@ -1083,7 +1161,9 @@ namespace Marvel {
 	{
 		int value;
 
-		if (!(*mvApp::GetApp()->getParsers())["set_style_antialiased_fill"].parse(args, kwargs, __FUNCTION__,
+		static mvPythonParser& parser = (*mvApp::GetApp()->getParsers())["set_style_antialiased_fill"];
+
+		if (!parser.parse(args, kwargs, __FUNCTION__,
 			&value))
 			return GetPyNone();
 
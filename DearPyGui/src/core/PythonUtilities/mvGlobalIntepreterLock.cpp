@@ -5,14 +5,46 @@
 
 namespace Marvel {
 
+	std::atomic<unsigned> mvGlobalIntepreterLock::s_ensureCount = 0;
+	std::atomic<unsigned> mvGlobalIntepreterLock::s_nestedCount = 0;
+	std::atomic<unsigned> mvGlobalIntepreterLock::s_frameEnsureCount = 0;
+	std::atomic<unsigned> mvGlobalIntepreterLock::s_frameNestedCount = 0;
+
 	mvGlobalIntepreterLock::mvGlobalIntepreterLock()
 	{
+		// commands called from python and nested translator calls already
+		// hold the lock, only threads without it need ensure/release
+		if (PyGILState_Check())
+		{
+			s_nestedCount.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
 		m_gstate = PyGILState_Ensure();
+		m_owner = true;
+		s_ensureCount.fetch_add(1, std::memory_order_relaxed);
 	}
 
 	mvGlobalIntepreterLock::~mvGlobalIntepreterLock()
 	{
-		PyGILState_Release(m_gstate);
+		if (m_owner)
+			PyGILState_Release(m_gstate);
+	}
+
+	unsigned mvGlobalIntepreterLock::GetFrameEnsureCount()
+	{
+		return s_frameEnsureCount;
+	}
+
+	unsigned mvGlobalIntepreterLock::GetFrameNestedCount()
+	{
+		return s_frameNestedCount;
+	}
+
+	void mvGlobalIntepreterLock::EndFrame()
+	{
+		s_frameEnsureCount = s_ensureCount.exchange(0);
+		s_frameNestedCount = s_nestedCount.exchange(0);
 	}
 
 }
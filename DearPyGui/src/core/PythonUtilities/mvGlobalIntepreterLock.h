@@ -3,13 +3,30 @@
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
 #include <time.h>
+#include <atomic>
 
 namespace Marvel {
 
+	//-----------------------------------------------------------------------------
+	// mvGILHeld
+	//     - Token proving the caller holds python's global interpreter lock.
+	//       Only a live mvGlobalIntepreterLock hands one out, so functions
+	//       taking a token can use the c api without locking again.
+	//-----------------------------------------------------------------------------
+	class mvGILHeld
+	{
+
+		friend class mvGlobalIntepreterLock;
+
+		mvGILHeld() = default;
+
+	};
+
 	//-----------------------------------------------------------------------------
 	// mvGlobalIntepreterLock
 	//     - A convience class to automatically handle aqcuiring and releasing
 	//       python's global intpreter lock between python c api calls.
+	//     - Does nothing when the calling thread already holds the lock.
 	//-----------------------------------------------------------------------------
 	class mvGlobalIntepreterLock
 	{
@@ -19,9 +36,26 @@ namespace Marvel {
 		mvGlobalIntepreterLock();
 		~mvGlobalIntepreterLock();
 
+		mvGlobalIntepreterLock(const mvGlobalIntepreterLock& other) = delete;
+		mvGlobalIntepreterLock& operator=(const mvGlobalIntepreterLock& other) = delete;
+
+		operator const mvGILHeld&() const { return m_held; }
+
+		// ensure/release pairs and skipped nested locks of the last frame
+		static unsigned GetFrameEnsureCount();
+		static unsigned GetFrameNestedCount();
+		static void     EndFrame();
+
 	private:
 
 		PyGILState_STATE m_gstate;
+		bool             m_owner = false;
+		mvGILHeld        m_held;
+
+		static std::atomic<unsigned> s_ensureCount;
+		static std::atomic<unsigned> s_nestedCount;
+		static std::atomic<unsigned> s_frameEnsureCount;
+		static std::atomic<unsigned> s_frameNestedCount;
 
 	};
 
@@ -7,6 +7,8 @@
 #include <utility>
 #include <frameobject.h>
 #include <ctime>
+#include <climits>
+#include <cstring>
 
 namespace Marvel {
 
@@ -76,6 +78,8 @@ namespace Marvel {
 		return PythonDataTypeSymbol(type); 
 	}
 
+	void (*mvPythonParser::s_stateChangeCallback)() = nullptr;
+
 	mvPythonParser::mvPythonParser(const std::initializer_list<mvPythonDataElement>& elements, 
 		std::string  about, std::string  returnType, std::string  category)
 		: m_elements(elements), m_about(std::move(about)), m_return(std::move(returnType)), m_category(std::move(category))
@@ -111,9 +115,40 @@ namespace Marvel {
 		m_formatstring.push_back(0);
 		m_keywords.push_back(NULL);
 
+		// argument layout used by parseFast
+		bool optionalFound = false;
+		bool keywordFound = false;
+		for (size_t i = 0; i < m_elements.size(); i++)
+		{
+			switch (m_elements[i].type)
+			{
+			case mvPythonDataType::Optional:    optionalFound = true; break;
+			case mvPythonDataType::KeywordOnly: keywordFound = true; break;
+			case mvPythonDataType::Kwargs:      break;
+			default:
+				m_slots.push_back(i);
+				if (!optionalFound && !keywordFound)
+					m_required++;
+				if (!keywordFound)
+					m_positional++;
+				break;
+			}
+		}
+
 		buildDocumentation();
 	}
 
+	static void ReportParseError(const char* message)
+	{
+		PyErr_Print();
+		mvAppLog::Show();
+		int line = PyFrame_GetLineNumber(PyEval_GetFrame());
+		PyObject* ex = PyErr_Format(PyExc_Exception,
+			"Error parsing DearPyGui %s command on line %d.", message, line);
+		PyErr_Print();
+		Py_XDECREF(ex);
+	}
+
 	bool mvPythonParser::parse(PyObject* args, PyObject* kwargs, const char* message, ...)
 	{
 
@@ -124,18 +159,181 @@ namespace Marvel {
 		if (!PyArg_VaParseTupleAndKeywords(args, kwargs, m_formatstring.data(),
 			const_cast<char**>(m_keywords.data()), arguments))
 		{
-			PyErr_Print();
 			check = false;
-			mvAppLog::Show();
-			int line = PyFrame_GetLineNumber(PyEval_GetFrame());
-			PyObject* ex = PyErr_Format(PyExc_Exception,
-				"Error parsing DearPyGui %s command on line %d.", message, line);
-			PyErr_Print();
-			Py_XDECREF(ex);
+			ReportParseError(message);
+		}
+
+		va_end(arguments);
+
+		if (check && !m_query && s_stateChangeCallback)
+			s_stateChangeCallback();
+
+		return check;
+	}
+
+	// converts one argument the way PyArg_Parse* would for the same symbol,
+	// writing through the matching pointer taken from the argument list
+	static bool ConvertFastArgument(char symbol, PyObject* obj, va_list& arguments, const char* name)
+	{
+		switch (symbol)
+		{
+		case 's':
+		{
+			const char** dest = va_arg(arguments, const char**);
+			if (obj == nullptr)
+				return true;
+			if (!PyUnicode_Check(obj))
+			{
+				PyErr_Format(PyExc_TypeError, "argument '%s' must be str, not %.50s", name, Py_TYPE(obj)->tp_name);
+				return false;
+			}
+			Py_ssize_t size = 0;
+			const char* value = PyUnicode_AsUTF8AndSize(obj, &size);
+			if (value == nullptr)
+				return false;
+			if ((Py_ssize_t)strlen(value) != size)
+			{
+				PyErr_SetString(PyExc_ValueError, "embedded null character");
+				return false;
+			}
+			*dest = value;
+			return true;
+		}
+
+		case 'i':
+		{
+			int* dest = va_arg(arguments, int*);
+			if (obj == nullptr)
+				return true;
+			if (PyFloat_Check(obj))
+			{
+				PyErr_SetString(PyExc_TypeError, "integer argument expected, got float");
+				return false;
+			}
+			long value = PyLong_AsLong(obj);
+			if (value == -1 && PyErr_Occurred())
+				return false;
+			if (value > INT_MAX || value < INT_MIN)
+			{
+				PyErr_SetString(PyExc_OverflowError, "signed integer is greater than maximum");
+				return false;
+			}
+			*dest = (int)value;
+			return true;
+		}
+
+		case 'f':
+		case 'd':
+		{
+			float* fdest = symbol == 'f' ? va_arg(arguments, float*) : nullptr;
+			double* ddest = symbol == 'd' ? va_arg(arguments, double*) : nullptr;
+			if (obj == nullptr)
+				return true;
+			double value = PyFloat_AsDouble(obj);
+			if (value == -1.0 && PyErr_Occurred())
+				return false;
+			if (fdest)
+				*fdest = (float)value;
+			else
+				*ddest = value;
+			return true;
+		}
+
+		case 'p':
+		{
+			int* dest = va_arg(arguments, int*);
+			if (obj == nullptr)
+				return true;
+			int value = PyObject_IsTrue(obj);
+			if (value < 0)
+				return false;
+			*dest = value;
+			return true;
+		}
+
+		default:
+		{
+			PyObject** dest = va_arg(arguments, PyObject**);
+			if (obj != nullptr)
+				*dest = obj;
+			return true;
+		}
+		}
+	}
+
+	bool mvPythonParser::parseFast(PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames, const char* message, ...)
+	{
+		// hot commands only take a handful of arguments
+		PyObject* stackValues[16] = {};
+		std::vector<PyObject*> heapValues;
+		PyObject** values = stackValues;
+		if (m_slots.size() > 16)
+		{
+			heapValues.resize(m_slots.size(), nullptr);
+			values = heapValues.data();
+		}
+
+		bool check = true;
+
+		if ((size_t)nargs > m_positional)
+		{
+			PyErr_Format(PyExc_TypeError, "%s() takes at most %d positional arguments (%d given)",
+				message, (int)m_positional, (int)nargs);
+			check = false;
 		}
 
+		for (Py_ssize_t i = 0; check && i < nargs; i++)
+			values[i] = args[i];
+
+		// keyword values follow the positional ones in args
+		Py_ssize_t kwcount = kwnames ? PyTuple_GET_SIZE(kwnames) : 0;
+		for (Py_ssize_t k = 0; check && k < kwcount; k++)
+		{
+			PyObject* key = PyTuple_GET_ITEM(kwnames, k);
+
+			size_t slot = 0;
+			while (slot < m_slots.size() && PyUnicode_CompareWithASCIIString(key, m_elements[m_slots[slot]].name.c_str()) != 0)
+				slot++;
+
+			if (slot == m_slots.size())
+			{
+				PyErr_Format(PyExc_TypeError, "'%U' is an invalid keyword argument for %s()", key, message);
+				check = false;
+			}
+			else if (values[slot] != nullptr)
+			{
+				PyErr_Format(PyExc_TypeError, "argument for %s() given by name ('%U') and position (%d)",
+					message, key, (int)slot + 1);
+				check = false;
+			}
+			else
+				values[slot] = args[nargs + k];
+		}
+
+		for (size_t i = 0; check && i < m_required; i++)
+		{
+			if (values[i] == nullptr)
+			{
+				PyErr_Format(PyExc_TypeError, "%s() missing required argument '%s' (pos %d)",
+					message, m_elements[m_slots[i]].name.c_str(), (int)i + 1);
+				check = false;
+			}
+		}
+
+		va_list arguments;
+		va_start(arguments, message);
+		for (size_t i = 0; check && i < m_slots.size(); i++)
+		{
+			const mvPythonDataElement& element = m_elements[m_slots[i]];
+			check = ConvertFastArgument(element.getSymbol(), values[i], arguments, element.name.c_str());
+		}
 		va_end(arguments);
 
+		if (!check)
+			ReportParseError(message);
+		else if (!m_query && s_stateChangeCallback)
+			s_stateChangeCallback();
+
 		return check;
 	}
 
@@ -63,6 +63,11 @@ namespace Marvel {
             std::string category = "App");
 
         bool                             parse(PyObject* args, PyObject* kwargs, const char* message, ...);
+
+        // same contract as parse() for commands registered with METH_FASTCALL;
+        // arguments are matched straight from the argument array and keyword
+        // names (no tuple, dict or format string) and **kwargs is not supported
+        bool                             parseFast(PyObject* const* args, Py_ssize_t nargs, PyObject* kwnames, const char* message, ...);
         [[nodiscard]] const char*        getDocumentation                () const { return m_documentation.c_str(); }
         [[nodiscard]] const std::string& getCategory                     () const { return m_category; }
         [[nodiscard]] const std::string& getReturnType                   () const { return m_return; }
@@ -72,13 +77,25 @@ namespace Marvel {
 
         void buildDocumentation();
 
+        // queries only read state, other commands notify the state change
+        // callback after a successful parse (used to request frames)
+        void        setQuery              (bool value) { m_query = value; }
+        bool        isQuery               () const { return m_query; }
+        static void SetStateChangeCallback(void (*callback)()) { s_stateChangeCallback = callback; }
+
     private:
 
+        static void (*s_stateChangeCallback)();
+
         std::vector<mvPythonDataElement> m_elements;
         std::vector<char>                m_formatstring;
         std::vector<const char*>         m_keywords;
+        std::vector<size_t>              m_slots;          // m_elements index of each real argument
+        size_t                           m_required   = 0; // leading slots that must be given
+        size_t                           m_positional = 0; // leading slots that may be given by position
         bool                             m_optional = false; // check if optional has been found already
         bool                             m_keyword  = false; // check if keyword has been found already
+        bool                             m_query    = false; // command only reads state
         std::string                      m_about;
         std::string                      m_return;
         std::string                      m_documentation;
@@ -3,9 +3,193 @@
 #include "mvAppLog.h"
 #include "mvPythonExceptions.h"
 #include "mvGlobalIntepreterLock.h"
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
 
 namespace Marvel {
 
+	//-----------------------------------------------------------------------------
+	// Fast converter helpers
+	//     - numeric buffers (array.array, numpy, memoryview) are copied with a
+	//       single typed loop, anything else goes through PySequence_Fast with
+	//       exact float/int objects unboxed directly
+	//-----------------------------------------------------------------------------
+
+	// element kind of a single-item native struct format: 'f', 'i' or 'u'
+	static char BufferKind(const Py_buffer& view)
+	{
+		const char* format = view.format ? view.format : "B";
+
+		switch (*format)
+		{
+#if PY_LITTLE_ENDIAN
+		case '>': case '!': return 0;
+		case '<':
+#else
+		case '<': return 0;
+		case '>': case '!':
+#endif
+		case '@': case '=': format++; break;
+		default: break;
+		}
+
+		if (format[0] == 0 || format[1] != 0)
+			return 0;
+
+		switch (format[0])
+		{
+		case 'f': return view.itemsize == 4 ? 'f' : 0;
+		case 'd': return view.itemsize == 8 ? 'f' : 0;
+		case 'b': case 'h': case 'i': case 'l': case 'q': case 'n': return 'i';
+		case 'B': case 'H': case 'I': case 'L': case 'Q': case 'N': case '?': return 'u';
+		default: return 0;
+		}
+	}
+
+	template<typename S, typename T>
+	static void CopyBuffer(const Py_buffer& view, Py_ssize_t rows, Py_ssize_t columns, T* out)
+	{
+		const char* base = static_cast<const char*>(view.buf);
+		Py_ssize_t rowStride = view.strides[0];
+		Py_ssize_t columnStride = view.ndim == 2 ? view.strides[1] : 0;
+
+		if (std::is_same<S, T>::value && PyBuffer_IsContiguous(&view, 'C'))
+		{
+			memcpy(out, base, rows * columns * sizeof(T));
+			return;
+		}
+
+		for (Py_ssize_t r = 0; r < rows; r++)
+		{
+			const char* row = base + r * rowStride;
+			for (Py_ssize_t c = 0; c < columns; c++)
+			{
+				S item;
+				memcpy(&item, row + c * columnStride, sizeof(S));
+				*out++ = (T)item;
+			}
+		}
+	}
+
+	// reads a 1D or 2D numeric buffer row-major into items; returns false when
+	// value does not export a usable buffer so callers fall back to sequences.
+	// bytes and bytearray aren't number lists, and float buffers are rejected
+	// for integer items instead of being truncated (rejected is set)
+	template<typename T>
+	static bool BufferToVect(PyObject* value, std::vector<T>& items, Py_ssize_t& columns, bool* rejected = nullptr)
+	{
+		if (!PyObject_CheckBuffer(value) || PyBytes_Check(value) || PyByteArray_Check(value))
+			return false;
+
+		Py_buffer view;
+		if (PyObject_GetBuffer(value, &view, PyBUF_RECORDS_RO) < 0)
+		{
+			PyErr_Clear();
+			return false;
+		}
+
+		char kind = BufferKind(view);
+		bool ok = kind != 0 && (view.ndim == 1 || view.ndim == 2);
+
+		if (ok && kind == 'f' && std::is_integral<T>::value)
+		{
+			ok = false;
+			if (rejected)
+				*rejected = true;
+		}
+
+		if (ok)
+		{
+			Py_ssize_t rows = view.shape[0];
+			columns = view.ndim == 2 ? view.shape[1] : 1;
+			items.resize(rows * columns);
+			T* out = items.data();
+
+			switch (kind == 'f' ? view.itemsize : kind == 'i' ? -view.itemsize : 16 + view.itemsize)
+			{
+			case 4:  CopyBuffer<float>   (view, rows, columns, out); break;
+			case 8:  CopyBuffer<double>  (view, rows, columns, out); break;
+			case -1: CopyBuffer<int8_t>  (view, rows, columns, out); break;
+			case -2: CopyBuffer<int16_t> (view, rows, columns, out); break;
+			case -4: CopyBuffer<int32_t> (view, rows, columns, out); break;
+			case -8: CopyBuffer<int64_t> (view, rows, columns, out); break;
+			case 17: CopyBuffer<uint8_t> (view, rows, columns, out); break;
+			case 18: CopyBuffer<uint16_t>(view, rows, columns, out); break;
+			case 20: CopyBuffer<uint32_t>(view, rows, columns, out); break;
+			case 24: CopyBuffer<uint64_t>(view, rows, columns, out); break;
+			default: ok = false; items.clear(); break;
+			}
+		}
+
+		PyBuffer_Release(&view);
+		return ok;
+	}
+
+	// new reference to a list/tuple view of value or nullptr for strings and
+	// non-sequences
+	static PyObject* FastSequence(PyObject* value)
+	{
+		if (PyList_Check(value) || PyTuple_Check(value))
+		{
+			Py_INCREF(value);
+			return value;
+		}
+
+		if (PyUnicode_Check(value) || PyBytes_Check(value) || PyByteArray_Check(value) || !PySequence_Check(value))
+			return nullptr;
+
+		PyObject* sequence = PySequence_Fast(value, "");
+		if (sequence == nullptr)
+			PyErr_Clear();
+		return sequence;
+	}
+
+	static inline bool FastNumber(PyObject* item, double& out)
+	{
+		if (PyFloat_CheckExact(item))
+			out = PyFloat_AS_DOUBLE(item);
+		else if (PyLong_CheckExact(item))
+			out = PyLong_AsDouble(item);
+		else if (PyNumber_Check(item))
+			out = PyFloat_AsDouble(item);
+		else
+			return false;
+
+		if (out == -1.0 && PyErr_Occurred())
+		{
+			PyErr_Clear();
+			return false;
+		}
+		return true;
+	}
+
+	// first count numbers of a point (list, tuple or buffer), zero filled
+	static void FastPoint(PyObject* value, float* out, int count, const mvGILHeld& gil, const std::string& message)
+	{
+		for (int i = 0; i < count; i++)
+			out[i] = 0.0f;
+
+		if (PyObject* sequence = FastSequence(value))
+		{
+			Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence);
+			PyObject** elements = PySequence_Fast_ITEMS(sequence);
+			int found = 0;
+			double number;
+			for (Py_ssize_t i = 0; i < size && found < count; i++)
+			{
+				if (FastNumber(elements[i], number))
+					out[found++] = (float)number;
+			}
+			Py_DECREF(sequence);
+			return;
+		}
+
+		std::vector<float> result = ToFloatVect(value, gil, message);
+		for (size_t i = 0; i < result.size() && i < (size_t)count; i++)
+			out[i] = result[i];
+	}
+
 	void UpdatePyIntList(PyObject* pyvalue, const std::vector<int>& value)
 	{
 		if (pyvalue == nullptr)
@@ -84,24 +268,44 @@ namespace Marvel {
 	PyObject* ToPyString(const std::string& value)
 	{
 		mvGlobalIntepreterLock gil;
+		return ToPyString(value, gil);
+	}
+
+	PyObject* ToPyString(const std::string& value, const mvGILHeld&)
+	{
 		return PyUnicode_FromString(value.c_str());
 	}
 
 	PyObject* ToPyFloat(float value)
 	{
 		mvGlobalIntepreterLock gil;
+		return ToPyFloat(value, gil);
+	}
+
+	PyObject* ToPyFloat(float value, const mvGILHeld&)
+	{
 		return PyFloat_FromDouble(value);
 	}
 
 	PyObject* ToPyInt(int value)
 	{
 		mvGlobalIntepreterLock gil;
+		return ToPyInt(value, gil);
+	}
+
+	PyObject* ToPyInt(int value, const mvGILHeld&)
+	{
 		return PyLong_FromLong(value);
 	}
 
 	PyObject* ToPyBool(bool value)
 	{
 		mvGlobalIntepreterLock gil;
+		return ToPyBool(value, gil);
+	}
+
+	PyObject* ToPyBool(bool value, const mvGILHeld&)
+	{
 		return PyBool_FromLong(value);
 	}
 
@@ -167,11 +371,15 @@ namespace Marvel {
 	PyObject* ToPyList(const std::vector<float>& value)
 	{
 		mvGlobalIntepreterLock gil;
+		return ToPyList(value, gil);
+	}
 
+	PyObject* ToPyList(const std::vector<float>& value, const mvGILHeld&)
+	{
 		PyObject* result = PyList_New(value.size());
 
 		for (size_t i = 0; i < value.size(); i++)
-			PyList_SetItem(result, i, PyFloat_FromDouble(value[i]));
+			PyList_SET_ITEM(result, i, PyFloat_FromDouble(value[i]));
 
 		return result;
 	}
@@ -179,11 +387,15 @@ namespace Marvel {
 	PyObject* ToPyList(const std::vector<std::string>& value)
 	{
 		mvGlobalIntepreterLock gil;
+		return ToPyList(value, gil);
+	}
 
+	PyObject* ToPyList(const std::vector<std::string>& value, const mvGILHeld&)
+	{
 		PyObject* result = PyList_New(value.size());
 
 		for (size_t i = 0; i < value.size(); i++)
-			PyList_SetItem(result, i, PyUnicode_FromString(value[i].c_str()));
+			PyList_SET_ITEM(result, i, PyUnicode_FromString(value[i].c_str()));
 
 		return result;
 	}
@@ -191,11 +403,15 @@ namespace Marvel {
 	PyObject* ToPyList(const std::vector<std::vector<std::string>>& value)
 	{
 		mvGlobalIntepreterLock gil;
+		return ToPyList(value, gil);
+	}
 
+	PyObject* ToPyList(const std::vector<std::vector<std::string>>& value, const mvGILHeld& held)
+	{
 		PyObject* result = PyList_New(value.size());
 
 		for (size_t i = 0; i < value.size(); i++)
-			PyList_SetItem(result, i, ToPyList(value[i]));
+			PyList_SET_ITEM(result, i, ToPyList(value[i], held));
 
 		return result;
 	}
@@ -218,10 +434,10 @@ namespace Marvel {
 
 		PyObject* result = PyList_New(4);
 
-		PyList_SetItem(result, 0, ToPyFloat((float)color.r));
-		PyList_SetItem(result, 1, ToPyFloat((float)color.g));
-		PyList_SetItem(result, 2, ToPyFloat((float)color.b));
-		PyList_SetItem(result, 3, ToPyFloat((float)color.a));
+		PyList_SetItem(result, 0, ToPyFloat((float)color.r, gil));
+		PyList_SetItem(result, 1, ToPyFloat((float)color.g, gil));
+		PyList_SetItem(result, 2, ToPyFloat((float)color.b, gil));
+		PyList_SetItem(result, 3, ToPyFloat((float)color.a, gil));
 
 		return result;
 	}
@@ -230,15 +446,15 @@ namespace Marvel {
 	{
 		mvGlobalIntepreterLock gil;
 		PyObject* dict = PyDict_New();
-		PyDict_SetItemString(dict, "sec",              ToPyInt(time.tm_sec));
-		PyDict_SetItemString(dict, "min",              ToPyInt(time.tm_min));
-		PyDict_SetItemString(dict, "hour",             ToPyInt(time.tm_hour));
-		PyDict_SetItemString(dict, "month_day",        ToPyInt(time.tm_mday));
-		PyDict_SetItemString(dict, "month",            ToPyInt(time.tm_mon));
-		PyDict_SetItemString(dict, "year",             ToPyInt(time.tm_year));
-		PyDict_SetItemString(dict, "week_day",         ToPyInt(time.tm_wday));
-		PyDict_SetItemString(dict, "year_day",         ToPyInt(time.tm_yday));
-		PyDict_SetItemString(dict, "daylight_savings", ToPyInt(time.tm_isdst));
+		PyDict_SetItemString(dict, "sec",              ToPyInt(time.tm_sec, gil));
+		PyDict_SetItemString(dict, "min",              ToPyInt(time.tm_min, gil));
+		PyDict_SetItemString(dict, "hour",             ToPyInt(time.tm_hour, gil));
+		PyDict_SetItemString(dict, "month_day",        ToPyInt(time.tm_mday, gil));
+		PyDict_SetItemString(dict, "month",            ToPyInt(time.tm_mon, gil));
+		PyDict_SetItemString(dict, "year",             ToPyInt(time.tm_year, gil));
+		PyDict_SetItemString(dict, "week_day",         ToPyInt(time.tm_wday, gil));
+		PyDict_SetItemString(dict, "year_day",         ToPyInt(time.tm_yday, gil));
+		PyDict_SetItemString(dict, "daylight_savings", ToPyInt(time.tm_isdst, gil));
 		return dict;
 	}
 
@@ -266,11 +482,104 @@ namespace Marvel {
 		return result;
 	}
 
+	//-----------------------------------------------------------------------------
+	// mvBufferSnapshot
+	//     - owns a copy of the values and exports them through the buffer
+	//       protocol with a typed format so memoryviews index as numbers
+	//-----------------------------------------------------------------------------
+	struct mvBufferSnapshot
+	{
+		PyObject_HEAD
+		char*      data;
+		Py_ssize_t count;
+		Py_ssize_t itemsize;
+		const char* format;
+	};
+
+	static int BufferSnapshotGetBuffer(PyObject* exporter, Py_buffer* view, int flags)
+	{
+		auto snapshot = reinterpret_cast<mvBufferSnapshot*>(exporter);
+
+		if (PyBuffer_FillInfo(view, exporter, snapshot->data, snapshot->count * snapshot->itemsize, 1, flags) < 0)
+			return -1;
+
+		view->itemsize = snapshot->itemsize;
+		if (flags & PyBUF_FORMAT)
+			view->format = const_cast<char*>(snapshot->format);
+		if (flags & PyBUF_ND)
+			view->shape = &snapshot->count;
+		if ((flags & PyBUF_STRIDES) == PyBUF_STRIDES)
+			view->strides = &snapshot->itemsize;
+
+		return 0;
+	}
+
+	static void BufferSnapshotDealloc(PyObject* self)
+	{
+		delete[] reinterpret_cast<mvBufferSnapshot*>(self)->data;
+		PyObject_Del(self);
+	}
+
+	static PyBufferProcs BufferSnapshotProcs = { BufferSnapshotGetBuffer, nullptr };
+	static PyTypeObject  BufferSnapshotType = { PyVarObject_HEAD_INIT(nullptr, 0) };
+
+	static PyObject* ToPyBufferSnapshot(const void* value, Py_ssize_t count, Py_ssize_t itemsize, const char* format)
+	{
+		mvGlobalIntepreterLock gil;
+
+		if (BufferSnapshotType.tp_name == nullptr)
+		{
+			BufferSnapshotType.tp_name = "dearpygui.core.mvBufferSnapshot";
+			BufferSnapshotType.tp_basicsize = sizeof(mvBufferSnapshot);
+			BufferSnapshotType.tp_flags = Py_TPFLAGS_DEFAULT;
+			BufferSnapshotType.tp_dealloc = BufferSnapshotDealloc;
+			BufferSnapshotType.tp_as_buffer = &BufferSnapshotProcs;
+			BufferSnapshotType.tp_doc = "Read-only snapshot of DearPyGui values.";
+			if (PyType_Ready(&BufferSnapshotType) < 0)
+			{
+				BufferSnapshotType.tp_name = nullptr;
+				return nullptr;
+			}
+		}
+
+		mvBufferSnapshot* snapshot = PyObject_New(mvBufferSnapshot, &BufferSnapshotType);
+		if (snapshot == nullptr)
+			return nullptr;
+
+		snapshot->data = new char[count * itemsize + 1];
+		snapshot->count = count;
+		snapshot->itemsize = itemsize;
+		snapshot->format = format;
+		if (count > 0)
+			memcpy(snapshot->data, value, count * itemsize);
+
+		// the memoryview keeps the snapshot alive
+		PyObject* view = PyMemoryView_FromObject(reinterpret_cast<PyObject*>(snapshot));
+		Py_DECREF(snapshot);
+		return view;
+	}
+
+	PyObject* ToPyBuffer(const std::vector<float>& value)
+	{
+		return ToPyBufferSnapshot(value.data(), (Py_ssize_t)value.size(), sizeof(float), "f");
+	}
+
+	PyObject* ToPyBuffer(const float* value, int count)
+	{
+		return ToPyBufferSnapshot(value, count, sizeof(float), "f");
+	}
+
+	PyObject* ToPyBuffer(const int* value, int count)
+	{
+		return ToPyBufferSnapshot(value, count, sizeof(int), "i");
+	}
+
 	tm ToTime(PyObject* value, const std::string& message)
 	{
 		tm result = {};
 		if (value == nullptr)
 			return result;
+		mvGlobalIntepreterLock gil;
 
 		if (!PyDict_Check(value))
 		{
@@ -278,27 +587,31 @@ namespace Marvel {
 			return result;
 		}
 
-		if (PyObject* item = PyDict_GetItemString(value, "sec"))              result.tm_sec = ToInt(item);
-		if (PyObject* item = PyDict_GetItemString(value, "min"))              result.tm_min = ToInt(item);
-		if (PyObject* item = PyDict_GetItemString(value, "hour"))             result.tm_hour = ToInt(item);
-		if (PyObject* item = PyDict_GetItemString(value, "month_day"))        result.tm_mday = ToInt(item);
+		if (PyObject* item = PyDict_GetItemString(value, "sec"))              result.tm_sec = ToInt(item, gil);
+		if (PyObject* item = PyDict_GetItemString(value, "min"))              result.tm_min = ToInt(item, gil);
+		if (PyObject* item = PyDict_GetItemString(value, "hour"))             result.tm_hour = ToInt(item, gil);
+		if (PyObject* item = PyDict_GetItemString(value, "month_day"))        result.tm_mday = ToInt(item, gil);
 		else result.tm_mday = 1;
-		if (PyObject* item = PyDict_GetItemString(value, "month"))            result.tm_mon = ToInt(item);
-		if (PyObject* item = PyDict_GetItemString(value, "year"))             result.tm_year = ToInt(item);
+		if (PyObject* item = PyDict_GetItemString(value, "month"))            result.tm_mon = ToInt(item, gil);
+		if (PyObject* item = PyDict_GetItemString(value, "year"))             result.tm_year = ToInt(item, gil);
 		else result.tm_year = 70;
-		if (PyObject* item = PyDict_GetItemString(value, "week_day"))         result.tm_wday = ToInt(item);
-		if (PyObject* item = PyDict_GetItemString(value, "year_day"))         result.tm_yday = ToInt(item);
-		if (PyObject* item = PyDict_GetItemString(value, "daylight_savings")) result.tm_isdst = ToInt(item);
+		if (PyObject* item = PyDict_GetItemString(value, "week_day"))         result.tm_wday = ToInt(item, gil);
+		if (PyObject* item = PyDict_GetItemString(value, "year_day"))         result.tm_yday = ToInt(item, gil);
+		if (PyObject* item = PyDict_GetItemString(value, "daylight_savings")) result.tm_isdst = ToInt(item, gil);
 
 		return result;
 	}
 
 	int ToInt(PyObject* value, const std::string& message)
 	{
-		if (value == nullptr)
-			return 0;
 		mvGlobalIntepreterLock gil;
+		return ToInt(value, gil, message);
+	}
 
+	int ToInt(PyObject* value, const mvGILHeld&, const std::string& message)
+	{
+		if (value == nullptr)
+			return 0;
 		if (!PyLong_Check(value))
 		{
 			ThrowPythonException(message);
@@ -310,10 +623,14 @@ namespace Marvel {
 
 	float ToFloat(PyObject* value, const std::string& message)
 	{
-		if (value == nullptr)
-			return 0.0f;
 		mvGlobalIntepreterLock gil;
+		return ToFloat(value, gil, message);
+	}
 
+	float ToFloat(PyObject* value, const mvGILHeld&, const std::string& message)
+	{
+		if (value == nullptr)
+			return 0.0f;
 		if (!PyNumber_Check(value))
 		{
 			ThrowPythonException(message);
@@ -325,10 +642,14 @@ namespace Marvel {
 
 	bool ToBool(PyObject* value, const std::string& message)
 	{
-		if (value == nullptr)
-			return false;
 		mvGlobalIntepreterLock gil;
+		return ToBool(value, gil, message);
+	}
 
+	bool ToBool(PyObject* value, const mvGILHeld&, const std::string& message)
+	{
+		if (value == nullptr)
+			return false;
 		if (!PyBool_Check(value))
 		{
 			ThrowPythonException(message);
@@ -339,13 +660,17 @@ namespace Marvel {
 	}
 
 	std::string ToString(PyObject* value, const std::string& message)
+	{
+		mvGlobalIntepreterLock gil;
+		return ToString(value, gil, message);
+	}
+
+	std::string ToString(PyObject* value, const mvGILHeld&, const std::string& message)
 	{
 		std::string result;
 		if (value == nullptr)
 			return result;
 
-		mvGlobalIntepreterLock gil;
-
 		if (PyUnicode_Check(value))
 		{
 			result = _PyUnicode_AsString(value);
@@ -367,65 +692,131 @@ namespace Marvel {
 	}
 
 	std::vector<int> ToIntVect(PyObject* value, const std::string& message)
+	{
+		mvGlobalIntepreterLock gil;
+		return ToIntVect(value, gil, message);
+	}
+
+	std::vector<int> ToIntVect(PyObject* value, const mvGILHeld&, const std::string& message)
 	{
 
 		std::vector<int> items;
 		if (value == nullptr)
 			return items;
-		mvGlobalIntepreterLock gil;
+		Py_ssize_t columns = 1;
+		bool rejected = false;
+		if (BufferToVect(value, items, columns, &rejected))
+			return items;
 
-		if (PyTuple_Check(value))
+		PyObject* sequence = rejected ? nullptr : FastSequence(value);
+		if (sequence == nullptr)
 		{
-			for (Py_ssize_t i = 0; i < PyTuple_Size(value); i++)
-			{
-				PyObject* item = PyTuple_GetItem(value, i);
-				if(PyLong_Check(item))
-					items.emplace_back(PyLong_AsLong(item));
-			}
+			ThrowPythonException(message);
+			return items;
 		}
 
-		else if (PyList_Check(value))
+		Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence);
+		PyObject** elements = PySequence_Fast_ITEMS(sequence);
+		items.reserve(size);
+		for (Py_ssize_t i = 0; i < size; i++)
 		{
-			for (Py_ssize_t i = 0; i < PyList_Size(value); i++)
-			{
-				PyObject* item = PyList_GetItem(value, i);
-				if (PyLong_Check(item))
-					items.emplace_back(PyLong_AsLong(item));
-			}
+			if (PyLong_Check(elements[i]))
+				items.push_back(PyLong_AsLong(elements[i]));
 		}
+		Py_DECREF(sequence);
 
-		else
+		return items;
+	}
+
+	std::vector<float> ToFloatVect(PyObject* value, const std::string& message)
+	{
+		mvGlobalIntepreterLock gil;
+		return ToFloatVect(value, gil, message);
+	}
+
+	std::vector<float> ToFloatVect(PyObject* value, const mvGILHeld&, const std::string& message)
+	{
+
+		std::vector<float> items;
+		if (value == nullptr)
+			return items;
+		Py_ssize_t columns = 1;
+		if (BufferToVect(value, items, columns))
+			return items;
+
+		PyObject* sequence = FastSequence(value);
+		if (sequence == nullptr)
+		{
 			ThrowPythonException(message);
+			return items;
+		}
 
+		Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence);
+		PyObject** elements = PySequence_Fast_ITEMS(sequence);
+		items.reserve(size);
+		double number;
+		for (Py_ssize_t i = 0; i < size; i++)
+		{
+			if (FastNumber(elements[i], number))
+				items.push_back((float)number);
+		}
+		Py_DECREF(sequence);
 
 		return items;
 	}
 
-	std::vector<float> ToFloatVect(PyObject* value, const std::string& message)
+	std::vector<unsigned char> ToUCharVect(PyObject* value, const std::string& message)
 	{
 
-		std::vector<float> items;
+		std::vector<unsigned char> items;
 		if (value == nullptr)
 			return items;
 		mvGlobalIntepreterLock gil;
 
+		// bytes, bytearray, memoryview, uint8 arrays, etc. are copied directly
+		if (PyObject_CheckBuffer(value))
+		{
+			Py_buffer buffer;
+			if (PyObject_GetBuffer(value, &buffer, PyBUF_CONTIG_RO | PyBUF_FORMAT) == 0)
+			{
+				if (buffer.itemsize == 1)
+				{
+					auto data = static_cast<const unsigned char*>(buffer.buf);
+					items.assign(data, data + buffer.len);
+				}
+				else
+					ThrowPythonException(message);
+				PyBuffer_Release(&buffer);
+			}
+			else
+			{
+				PyErr_Clear();
+				ThrowPythonException(message);
+			}
+			return items;
+		}
+
+		auto clamp = [](long item) { return (unsigned char)(item < 0 ? 0 : (item > 255 ? 255 : item)); };
+
 		if (PyTuple_Check(value))
 		{
+			items.reserve(PyTuple_Size(value));
 			for (Py_ssize_t i = 0; i < PyTuple_Size(value); i++)
 			{
 				PyObject* item = PyTuple_GetItem(value, i);
-				if (PyNumber_Check(item))
-					items.emplace_back(PyFloat_AsDouble(item));
+				if (PyLong_Check(item))
+					items.emplace_back(clamp(PyLong_AsLong(item)));
 			}
 		}
 
 		else if (PyList_Check(value))
 		{
+			items.reserve(PyList_Size(value));
 			for (Py_ssize_t i = 0; i < PyList_Size(value); i++)
 			{
 				PyObject* item = PyList_GetItem(value, i);
-				if (PyNumber_Check(item))
-					items.emplace_back(PyFloat_AsDouble(item));
+				if (PyLong_Check(item))
+					items.emplace_back(clamp(PyLong_AsLong(item)));
 			}
 		}
 
@@ -437,48 +828,44 @@ namespace Marvel {
 	}
 
 	std::vector<std::string> ToStringVect(PyObject* value, const std::string& message)
+	{
+		mvGlobalIntepreterLock gil;
+		return ToStringVect(value, gil, message);
+	}
+
+	std::vector<std::string> ToStringVect(PyObject* value, const mvGILHeld&, const std::string& message)
 	{
 
 		std::vector<std::string> items;
 		if (value == nullptr)
 			return items;
-		mvGlobalIntepreterLock gil;
-
-		if (PyTuple_Check(value))
+		PyObject* sequence = FastSequence(value);
+		if (sequence == nullptr)
 		{
-			for (Py_ssize_t i = 0; i < PyTuple_Size(value); i++)
-			{
-				PyObject* item = PyTuple_GetItem(value, i);
-				if (PyUnicode_Check(item))
-					items.emplace_back(_PyUnicode_AsString(item));
-				else
-				{
-					PyObject* str = PyObject_Str(item);
-					items.emplace_back(_PyUnicode_AsString(str));
-					Py_XDECREF(str);
-				}
-			}
+			ThrowPythonException(message);
+			return items;
 		}
 
-		else if (PyList_Check(value))
+		Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence);
+		PyObject** elements = PySequence_Fast_ITEMS(sequence);
+		items.reserve(size);
+		for (Py_ssize_t i = 0; i < size; i++)
 		{
-			for (Py_ssize_t i = 0; i < PyList_Size(value); i++)
+			PyObject* item = elements[i];
+			if (PyUnicode_Check(item))
 			{
-				PyObject* item = PyList_GetItem(value, i);
-				if (PyUnicode_Check(item))
-					items.emplace_back(_PyUnicode_AsString(item));
-				else
-				{
-					PyObject* str = PyObject_Str(item);
-					items.emplace_back(_PyUnicode_AsString(str));
-					Py_XDECREF(str);
-				}
+				Py_ssize_t length = 0;
+				const char* text = PyUnicode_AsUTF8AndSize(item, &length);
+				items.emplace_back(text, length);
+			}
+			else
+			{
+				PyObject* str = PyObject_Str(item);
+				items.emplace_back(_PyUnicode_AsString(str));
+				Py_XDECREF(str);
 			}
 		}
-
-		else
-			ThrowPythonException(message);
-
+		Py_DECREF(sequence);
 
 		return items;
 	}
@@ -595,19 +982,41 @@ namespace Marvel {
 			return items;
 		mvGlobalIntepreterLock gil;
 
-		if (PyTuple_Check(value))
+		// (n, k) numeric arrays are flattened directly
+		std::vector<float> flat;
+		Py_ssize_t columns = 1;
+		if (BufferToVect(value, flat, columns))
 		{
-			for (Py_ssize_t i = 0; i < PyTuple_Size(value); i++)
-				items.push_back(ToVec2(PyTuple_GetItem(value, i)));
+			Py_ssize_t rows = columns > 0 ? (Py_ssize_t)flat.size() / columns : 0;
+			Py_ssize_t used = columns < 2 ? columns : 2;
+			items.resize(rows);
+			for (Py_ssize_t r = 0; r < rows; r++)
+			{
+				float point[2] = {};
+				for (Py_ssize_t c = 0; c < used; c++)
+					point[c] = flat[r * columns + c];
+				items[r] = { point[0], point[1] };
+			}
+			return items;
 		}
-		else if (PyList_Check(value))
+
+		PyObject* sequence = FastSequence(value);
+		if (sequence == nullptr)
 		{
-			for (Py_ssize_t i = 0; i < PyList_Size(value); i++)
-				items.push_back(ToVec2(PyList_GetItem(value, i)));
+			ThrowPythonException(message);
+			return items;
 		}
 
-		else
-			ThrowPythonException(message);
+		Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence);
+		PyObject** elements = PySequence_Fast_ITEMS(sequence);
+		items.reserve(size);
+		for (Py_ssize_t i = 0; i < size; i++)
+		{
+			float point[2];
+			FastPoint(elements[i], point, 2, gil, message);
+			items.push_back({ point[0], point[1] });
+		}
+		Py_DECREF(sequence);
 
 		return items;
 	}
@@ -622,14 +1031,14 @@ namespace Marvel {
 		if (PyTuple_Check(value))
 		{
 			if (PyTuple_Size(value) != 2) ThrowPythonException(message);
-			items.first = ToFloatVect(PyTuple_GetItem(value, 0), message);
-			items.second = ToFloatVect(PyTuple_GetItem(value, 1), message);
+			items.first = ToFloatVect(PyTuple_GetItem(value, 0), gil, message);
+			items.second = ToFloatVect(PyTuple_GetItem(value, 1), gil, message);
 		}
 		else if (PyList_Check(value))
 		{
 			if (PyList_Size(value) != 2) ThrowPythonException(message);
-			items.first = ToFloatVect(PyList_GetItem(value, 0), message);
-			items.second = ToFloatVect(PyList_GetItem(value, 1), message);
+			items.first = ToFloatVect(PyList_GetItem(value, 0), gil, message);
+			items.second = ToFloatVect(PyList_GetItem(value, 1), gil, message);
 		}
 
 		else
@@ -645,19 +1054,41 @@ namespace Marvel {
 			return items;
 		mvGlobalIntepreterLock gil;
 
-		if (PyTuple_Check(value))
+		// (n, k) numeric arrays are flattened directly
+		std::vector<float> flat;
+		Py_ssize_t columns = 1;
+		if (BufferToVect(value, flat, columns))
 		{
-			for (Py_ssize_t i = 0; i < PyTuple_Size(value); i++)
-				items.push_back(ToVec4(PyTuple_GetItem(value, i)));
+			Py_ssize_t rows = columns > 0 ? (Py_ssize_t)flat.size() / columns : 0;
+			Py_ssize_t used = columns < 4 ? columns : 4;
+			items.resize(rows);
+			for (Py_ssize_t r = 0; r < rows; r++)
+			{
+				float point[4] = {};
+				for (Py_ssize_t c = 0; c < used; c++)
+					point[c] = flat[r * columns + c];
+				items[r] = { point[0], point[1], point[2], point[3] };
+			}
+			return items;
 		}
-		else if (PyList_Check(value))
+
+		PyObject* sequence = FastSequence(value);
+		if (sequence == nullptr)
 		{
-			for (Py_ssize_t i = 0; i < PyList_Size(value); i++)
-				items.push_back(ToVec4(PyList_GetItem(value, i)));
+			ThrowPythonException(message);
+			return items;
 		}
 
-		else
-			ThrowPythonException(message);
+		Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence);
+		PyObject** elements = PySequence_Fast_ITEMS(sequence);
+		items.reserve(size);
+		for (Py_ssize_t i = 0; i < size; i++)
+		{
+			float point[4];
+			FastPoint(elements[i], point, 4, gil, message);
+			items.push_back({ point[0], point[1], point[2], point[3] });
+		}
+		Py_DECREF(sequence);
 
 		return items;
 	}
@@ -735,17 +1166,16 @@ namespace Marvel {
 			return items;
 		mvGlobalIntepreterLock gil;
 
-		if (PyTuple_Check(value))
-		{
-			for (Py_ssize_t i = 0; i < PyTuple_Size(value); i++)
-				items.emplace_back(ToStringVect(PyTuple_GetItem(value, i), message));
-		}
+		PyObject* sequence = FastSequence(value);
+		if (sequence == nullptr)
+			return items;
 
-		else if (PyList_Check(value))
-		{
-			for (Py_ssize_t i = 0; i < PyList_Size(value); i++)
-				items.emplace_back(ToStringVect(PyList_GetItem(value, i), message));
-		}
+		Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence);
+		PyObject** elements = PySequence_Fast_ITEMS(sequence);
+		items.reserve(size);
+		for (Py_ssize_t i = 0; i < size; i++)
+			items.emplace_back(ToStringVect(elements[i], gil, message));
+		Py_DECREF(sequence);
 
 		return items;
 	}
@@ -792,17 +1222,16 @@ namespace Marvel {
 			return items;
 		mvGlobalIntepreterLock gil;
 
-		if (PyTuple_Check(value))
-		{
-			for (Py_ssize_t i = 0; i < PyTuple_Size(value); i++)
-				items.emplace_back(ToFloatVect(PyTuple_GetItem(value, i), message));
-		}
+		PyObject* sequence = FastSequence(value);
+		if (sequence == nullptr)
+			return items;
 
-		else if (PyList_Check(value))
-		{
-			for (Py_ssize_t i = 0; i < PyList_Size(value); i++)
-				items.emplace_back(ToFloatVect(PyList_GetItem(value, i), message));
-		}
+		Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence);
+		PyObject** elements = PySequence_Fast_ITEMS(sequence);
+		items.reserve(size);
+		for (Py_ssize_t i = 0; i < size; i++)
+			items.emplace_back(ToFloatVect(elements[i], gil, message));
+		Py_DECREF(sequence);
 
 		return items;
 	}
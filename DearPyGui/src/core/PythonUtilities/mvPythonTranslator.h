@@ -12,6 +12,7 @@
 #include <vector>
 #include <map>
 #include "mvCore.h"
+#include "mvGlobalIntepreterLock.h"
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
 #include <time.h>
@@ -38,9 +39,25 @@ namespace Marvel {
 	PyObject*   ToPyColor (const mvColor& color);
 	PyObject*   ToPyTime  (const tm& time);
 
+	// overloads taking a held lock for use inside an existing lock scope
+	// (nested conversions, config dicts) so the lock is taken only once
+	PyObject*   ToPyString(const std::string& value, const mvGILHeld& gil);
+	PyObject*   ToPyFloat (float value, const mvGILHeld& gil);
+	PyObject*   ToPyInt   (int value, const mvGILHeld& gil);
+	PyObject*   ToPyBool  (bool value, const mvGILHeld& gil);
+	PyObject*   ToPyList  (const std::vector<float>& value, const mvGILHeld& gil);
+	PyObject*   ToPyList  (const std::vector<std::string>& value, const mvGILHeld& gil);
+	PyObject*   ToPyList  (const std::vector<std::vector<std::string>>& value, const mvGILHeld& gil);
+
 	PyObject*   ToPyIntList  (int* value, int count);
 	PyObject*   ToPyFloatList(float* value, int count);
 
+	// read-only memoryviews over a snapshot of the values (a single copy and
+	// no per-element objects) which numpy.frombuffer can consume directly
+	PyObject*   ToPyBuffer(const std::vector<float>& value);
+	PyObject*   ToPyBuffer(const float* value, int count);
+	PyObject*   ToPyBuffer(const int* value, int count);
+
 	// updates
 	void        UpdatePyIntList         (PyObject* pyvalue, const std::vector<int>& value);
 	void        UpdatePyFloatList       (PyObject* pyvalue, const std::vector<float>& value);
@@ -56,11 +73,21 @@ namespace Marvel {
 	std::string ToString(PyObject* value, const std::string& message = "Type must be a string.");
 	tm          ToTime  (PyObject* value, const std::string& message = "Type must be a dict");
 
+	// held lock overloads
+	int                      ToInt       (PyObject* value, const mvGILHeld& gil, const std::string& message = "Type must be an integer.");
+	float                    ToFloat     (PyObject* value, const mvGILHeld& gil, const std::string& message = "Type must be a float.");
+	bool                     ToBool      (PyObject* value, const mvGILHeld& gil, const std::string& message = "Type must be a bool.");
+	std::string              ToString    (PyObject* value, const mvGILHeld& gil, const std::string& message = "Type must be a string.");
+	std::vector<int>         ToIntVect   (PyObject* value, const mvGILHeld& gil, const std::string& message = "Type must be a list or tuple of integers.");
+	std::vector<float>       ToFloatVect (PyObject* value, const mvGILHeld& gil, const std::string& message = "Type must be a list or tuple of floats.");
+	std::vector<std::string> ToStringVect(PyObject* value, const mvGILHeld& gil, const std::string& message = "Type must be a list or tuple of strings.");
+
 	std::vector<mvVec2>                              ToVectVec2           (PyObject* value, const std::string& message = "Type must be a list/tuple of list/tuple.");
 	std::pair<std::vector<float>, std::vector<float>>ToPairVec            (PyObject* value, const std::string& message = "Type must be a list/tuple of two list/tuple.");
 	std::vector<mvVec4>                              ToVectVec4           (PyObject* value, const std::string& message = "Type must be a list/tuple of list/tuple.");
 	std::vector<int>                                 ToIntVect            (PyObject* value, const std::string& message = "Type must be a list or tuple of integers.");
 	std::vector<float>                               ToFloatVect          (PyObject* value, const std::string& message = "Type must be a list or tuple of floats.");
+	std::vector<unsigned char>                       ToUCharVect          (PyObject* value, const std::string& message = "Type must be a bytes-like object or a list or tuple of integers.");
 	std::vector<std::string>                         ToStringVect         (PyObject* value, const std::string& message = "Type must be a list or tuple of strings.");
 	std::vector<std::pair<int, int>>                 ToVectInt2           (PyObject* value, const std::string& message = "Type must be an list/tuple of integer.");
 	std::vector<std::pair<std::string, std::string>> ToVectPairString     (PyObject* value, const std::string& message = "Type must be an list/tuple of string pairs.");
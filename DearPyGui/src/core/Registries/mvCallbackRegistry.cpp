@@ -4,10 +4,58 @@
 #include "mvPythonExceptions.h"
 #include "mvThreadPool.h"
 #include "mvProfiler.h"
+#include "mvCostTracker.h"
 #include "mvGlobalIntepreterLock.h"
+#include "mvApp.h"
 
 namespace Marvel {
 
+	// name the cost tracker charges a callback to (only looked up on sampled frames)
+	static std::string GetCallableName(PyObject* callable)
+	{
+		std::string name;
+		mvPyObject qualname(PyObject_GetAttrString(callable, "__qualname__"));
+		if (qualname.isOk() && PyUnicode_Check(qualname))
+			name = PyUnicode_AsUTF8(qualname);
+		else
+			name = Py_TYPE(callable)->tp_name;
+		PyErr_Clear();
+		return name;
+	}
+
+	// calls without building an argument tuple where the interpreter allows it
+	static PyObject* CallWithArgs(PyObject* callable, PyObject** args, size_t nargs)
+	{
+#if PY_VERSION_HEX >= 0x03090000
+		return PyObject_Vectorcall(callable, args, nargs, nullptr);
+#elif PY_VERSION_HEX >= 0x03080000
+		return _PyObject_Vectorcall(callable, args, nargs, nullptr);
+#else
+		return _PyObject_FastCall(callable, args, (Py_ssize_t)nargs);
+#endif
+	}
+
+	// returns cache (new reference) when only the registry still references
+	// it, otherwise a fresh list replaces it
+	static PyObject* ReuseList(PyObject*& cache, Py_ssize_t size)
+	{
+		if (cache == nullptr || Py_REFCNT(cache) != 1 || PyList_GET_SIZE(cache) != size)
+		{
+			Py_XDECREF(cache);
+			cache = PyList_New(size);
+		}
+
+		Py_INCREF(cache);
+		return cache;
+	}
+
+	static void SetListItem(PyObject* list, Py_ssize_t index, PyObject* item)
+	{
+		PyObject* old = PyList_GET_ITEM(list, index);
+		PyList_SET_ITEM(list, index, item);
+		Py_XDECREF(old);
+	}
+
 	mvCallbackRegistry* mvCallbackRegistry::s_instance = nullptr;
 
 	mvCallbackRegistry* mvCallbackRegistry::GetCallbackRegistry()
@@ -58,6 +106,7 @@ namespace Marvel {
 	{
 		MV_PROFILE_FUNCTION()
 
+		runMouseMoveCallback();
 		runCallbacks();
 
 		return false;
@@ -80,45 +129,79 @@ namespace Marvel {
 		switch (event.type)
 		{
 		case mvEVT_KEY_PRESS:
-			runCallback(m_acceleratorCallback, active, ToPyInt(GetEInt(event, "KEY")));
-			runCallback(m_keyPressCallback, active, ToPyInt(GetEInt(event, "KEY")));
+			if (m_acceleratorCallback)
+				runCallback(m_acceleratorCallback, active, ToPyInt(GetEInt(event, "KEY")));
+			if (m_keyPressCallback)
+				runCallback(m_keyPressCallback, active, ToPyInt(GetEInt(event, "KEY")));
 			break;
 
 		case mvEVT_KEY_DOWN:
-			runCallback(m_keyDownCallback, active, ToPyMPair(GetEInt(event, "KEY"), GetEFloat(event, "DURATION")));
+			if (m_keyDownCallback)
+			{
+				mvGlobalIntepreterLock gil;
+				PyObject* data = ReuseList(m_keyDownData, 2);
+				SetListItem(data, 0, ToPyInt(GetEInt(event, "KEY"), gil));
+				SetListItem(data, 1, ToPyFloat(GetEFloat(event, "DURATION"), gil));
+				runCallback(m_keyDownCallback, active, data);
+			}
 			break;
 
 		case mvEVT_KEY_RELEASE:
-			runCallback(m_keyReleaseCallback, active, ToPyInt(GetEInt(event, "KEY")));
+			if (m_keyReleaseCallback)
+				runCallback(m_keyReleaseCallback, active, ToPyInt(GetEInt(event, "KEY")));
 			break;
 
 		case mvEVT_MOUSE_WHEEL:
-			runCallback(m_mouseWheelCallback, active, ToPyInt(GetEFloat(event, "DELTA")));
+			if (m_mouseWheelCallback)
+				runCallback(m_mouseWheelCallback, active, ToPyInt(GetEFloat(event, "DELTA")));
 			break;
 
 		case mvEVT_MOUSE_DRAG:
-			runCallback(m_mouseDragCallback, active, 
-				ToPyMTrip(GetEInt(event, "BUTTON"), GetEFloat(event, "X"), GetEFloat(event, "Y")));
+			if (m_mouseDragCallback)
+			{
+				mvGlobalIntepreterLock gil;
+				PyObject* data = ReuseList(m_mouseDragData, 3);
+				SetListItem(data, 0, ToPyInt(GetEInt(event, "BUTTON"), gil));
+				SetListItem(data, 1, ToPyFloat(GetEFloat(event, "X"), gil));
+				SetListItem(data, 2, ToPyFloat(GetEFloat(event, "Y"), gil));
+				runCallback(m_mouseDragCallback, active, data);
+			}
 			break;
 
 		case mvEVT_MOUSE_CLICK:
-			runCallback(m_mouseClickCallback, active, ToPyInt(GetEInt(event, "BUTTON")));
+			if (m_mouseClickCallback)
+				runCallback(m_mouseClickCallback, active, ToPyInt(GetEInt(event, "BUTTON")));
 			break;
 
 		case mvEVT_MOUSE_DOWN:
-			runCallback(m_mouseDownCallback, active, ToPyMPair(GetEInt(event, "BUTTON"), GetEFloat(event, "DURATION")));
+			if (m_mouseDownCallback)
+			{
+				mvGlobalIntepreterLock gil;
+				PyObject* data = ReuseList(m_mouseDownData, 2);
+				SetListItem(data, 0, ToPyInt(GetEInt(event, "BUTTON"), gil));
+				SetListItem(data, 1, ToPyFloat(GetEFloat(event, "DURATION"), gil));
+				runCallback(m_mouseDownCallback, active, data);
+			}
 			break;
 
 		case mvEVT_MOUSE_DBL_CLK:
-			runCallback(m_mouseDoubleClickCallback, active, ToPyInt(GetEInt(event, "BUTTON")));
+			if (m_mouseDoubleClickCallback)
+				runCallback(m_mouseDoubleClickCallback, active, ToPyInt(GetEInt(event, "BUTTON")));
 			break;
 
 		case mvEVT_MOUSE_RELEASE:
-			runCallback(m_mouseReleaseCallback, active, ToPyInt(GetEInt(event, "BUTTON")));
+			if (m_mouseReleaseCallback)
+				runCallback(m_mouseReleaseCallback, active, ToPyInt(GetEInt(event, "BUTTON")));
 			break;
 
 		case mvEVT_MOUSE_MOVE:
-			runCallback(m_mouseMoveCallback, active, ToPyPair(GetEFloat(event, "X"), GetEFloat(event, "Y")));
+			// coalesced, delivered at the end of the frame
+			if (m_mouseMoveCallback)
+			{
+				m_mouseMoved = true;
+				m_mouseMoveSender = GetEString(event, "WINDOW");
+				m_mouseMovePos = { GetEFloat(event, "X"), GetEFloat(event, "Y") };
+			}
 			break;
 
 		default:
@@ -128,6 +211,59 @@ namespace Marvel {
 		return true;
 	}
 
+	void mvCallbackRegistry::runMouseMoveCallback()
+	{
+		if (!m_mouseMoved)
+			return;
+		m_mouseMoved = false;
+
+		if (m_mouseMoveCallback == nullptr)
+			return;
+
+		mvGlobalIntepreterLock gil;
+		PyObject* data = ReuseList(m_mouseMoveData, 2);
+		SetListItem(data, 0, ToPyFloat(m_mouseMovePos.x, gil));
+		SetListItem(data, 1, ToPyFloat(m_mouseMovePos.y, gil));
+		runCallback(m_mouseMoveCallback, m_mouseMoveSender, data);
+	}
+
+	PyObject* mvCallbackRegistry::getSender(const std::string& sender)
+	{
+		auto found = m_senders.find(sender);
+		if (found != m_senders.end())
+		{
+			Py_INCREF(found->second);
+			return found->second;
+		}
+
+		// item names come and go, keep the cache bounded
+		if (m_senders.size() >= 1024)
+		{
+			for (auto& cached : m_senders)
+				Py_DECREF(cached.second);
+			m_senders.clear();
+		}
+
+		PyObject* pysender = PyUnicode_InternFromString(sender.c_str());
+		m_senders[sender] = pysender;
+		Py_INCREF(pysender);
+		return pysender;
+	}
+
+	void mvCallbackRegistry::releaseCachedObjects()
+	{
+		mvGlobalIntepreterLock gil;
+
+		for (auto& cached : m_senders)
+			Py_DECREF(cached.second);
+		m_senders.clear();
+
+		Py_CLEAR(m_keyDownData);
+		Py_CLEAR(m_mouseDownData);
+		Py_CLEAR(m_mouseDragData);
+		Py_CLEAR(m_mouseMoveData);
+	}
+
 	void mvCallbackRegistry::runAsyncCallbackReturns()
 	{
 		// check if any asyncronous functions have returned
@@ -146,11 +282,20 @@ namespace Marvel {
 
 	void mvCallbackRegistry::runCallbacks()
 	{
+		if (m_callbacks.empty())
+			return;
+
+		// one lock for the whole queue
+		mvGlobalIntepreterLock gil;
+
 		while (!m_callbacks.empty())
 		{
 			NewCallback callback = m_callbacks.front();
-			runCallback(callback.callback, callback.sender, callback.data);
 			m_callbacks.pop();
+
+			// queued data is borrowed from the item
+			Py_XINCREF(callback.data);
+			runCallback(callback.callback, callback.sender, callback.data);
 		}
 	}
 
@@ -191,12 +336,11 @@ namespace Marvel {
 		{
 			PyErr_Clear();
 
-			//PyObject* pArgs = PyTuple_New(2);
-			mvPyObject pArgs(PyTuple_New(2));
-			PyTuple_SetItem(pArgs, 0, PyUnicode_FromString("Async"));
-			PyTuple_SetItem(pArgs, 1, data); // steals data, so don't deref
+			mvPyObject pData(data); // reference taken by addMTCallback
+			mvPyObject pSender(getSender("Async"));
+			PyObject* args[2] = { pSender, data ? data : Py_None };
 
-			mvPyObject result(PyObject_CallObject(callback, pArgs));
+			mvPyObject result(CallWithArgs(callback, args, 2));
 
 			// check if call succeeded
 			if (!result.isOk())
@@ -210,6 +354,7 @@ namespace Marvel {
 				result.addRef();
 				std::lock_guard<std::mutex> lock(m_mutex);
 				m_asyncReturns.push({ returnname, result });
+				mvApp::RequestFrames();
 			}
 
 			// check if error occurred
@@ -248,7 +393,10 @@ namespace Marvel {
 		if (callable == nullptr)
 		{
 			if (data != nullptr)
+			{
+				mvGlobalIntepreterLock gil;
 				Py_XDECREF(data);
+			}
 			return;
 		}
 
@@ -268,15 +416,18 @@ namespace Marvel {
 			Py_XINCREF(data);
 		}
 
-		Py_XINCREF(data);
+		mvPyObject pData(data);
 
 		PyErr_Clear();
 
-		mvPyObject pArgs(PyTuple_New(2));
-		PyTuple_SetItem(pArgs, 0, PyUnicode_FromString(sender.c_str()));
-		PyTuple_SetItem(pArgs, 1, data); // steals data, so don't deref
+		mvPyObject pSender(getSender(sender));
+		PyObject* args[2] = { pSender, data };
 
-		mvPyObject result(PyObject_CallObject(callable, pArgs));
+		std::string costName;
+		if (mvCostTracker::IsSampling())
+			costName = GetCallableName(callable);
+		mvCostScope cost(costName, mvCostType::Callback);
+		mvPyObject result(CallWithArgs(callable, args, 2));
 
 		// check if call succeeded
 		if (!result.isOk())
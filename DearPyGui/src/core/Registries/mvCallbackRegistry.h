@@ -2,7 +2,9 @@
 #include <queue>
 #include <string>
 #include <mutex>
+#include <unordered_map>
 #include "mvEvents.h"
+#include "mvCore.h"
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
 
@@ -43,6 +45,7 @@ namespace Marvel {
 		bool onInputs  (mvEvent& event);
 		bool onRender  (mvEvent& event);
 
+		// data references passed to run*Callback are stolen
 		void runReturnCallback(PyObject* callback, const std::string& sender, PyObject* data);
         void runCallback      (PyObject* callback, const std::string& sender, PyObject* data = nullptr);
         void runAsyncCallback (PyObject* callback, PyObject* data, PyObject* returnname);
@@ -55,6 +58,9 @@ namespace Marvel {
 
 		bool hasAsyncCallbacks() { return !m_asyncCallbacks.empty(); }
 
+		// drops the cached sender strings and input lists (app shutdown)
+		void releaseCachedObjects();
+
 		//-----------------------------------------------------------------------------
         // Callbacks
         //----------------------------------------------------------------------------- 
@@ -73,6 +79,7 @@ namespace Marvel {
         void setKeyDownCallback         (PyObject* callback) { m_keyDownCallback = SanitizeCallback(callback); }
         void setKeyPressCallback        (PyObject* callback) { m_keyPressCallback = SanitizeCallback(callback); }
         void setKeyReleaseCallback      (PyObject* callback) { m_keyReleaseCallback = SanitizeCallback(callback); }
+        void setTextureLoadedCallback   (PyObject* callback) { m_textureLoadedCallback = SanitizeCallback(callback); }
 
         [[nodiscard]] PyObject* getRenderCallback          (){ return m_renderCallback; }
         [[nodiscard]] PyObject* getResizeCallback          (){ return m_resizeCallback; }
@@ -89,11 +96,17 @@ namespace Marvel {
         [[nodiscard]] PyObject* getOnCloseCallback         (){ return m_onCloseCallback; }
         [[nodiscard]] PyObject* getOnStartCallback         (){ return m_onStartCallback; }
         [[nodiscard]] PyObject* getAcceleratorCallback     (){ return m_acceleratorCallback; }
+        [[nodiscard]] PyObject* getTextureLoadedCallback   (){ return m_textureLoadedCallback; }
 	
 	private:
 
 		mvCallbackRegistry();
 
+		// interned sender string (new reference), requires the GIL
+		PyObject* getSender(const std::string& sender);
+
+		void runMouseMoveCallback();
+
 		static mvCallbackRegistry*       s_instance;
 		mutable std::mutex               m_mutex;
 
@@ -104,6 +117,20 @@ namespace Marvel {
 		std::queue<AsyncronousCallback>  m_asyncReturns;
 		std::vector<AsyncronousCallback> m_asyncCallbacks;
 
+		// sender strings are created once and reused while the GIL is held
+		std::unordered_map<std::string, PyObject*> m_senders;
+
+		// input data lists are reused while python kept no reference to them
+		PyObject* m_keyDownData   = nullptr;
+		PyObject* m_mouseDownData = nullptr;
+		PyObject* m_mouseDragData = nullptr;
+		PyObject* m_mouseMoveData = nullptr;
+
+		// only the latest mouse move of a frame is delivered
+		bool        m_mouseMoved = false;
+		std::string m_mouseMoveSender;
+		mvVec2      m_mouseMovePos = { 0.0f, 0.0f };
+
 		// input callbacks
 		PyObject* m_renderCallback = nullptr;
 		PyObject* m_mouseDownCallback = nullptr;
@@ -120,6 +147,7 @@ namespace Marvel {
 		PyObject* m_onCloseCallback = nullptr;
 		PyObject* m_onStartCallback = nullptr;
 		PyObject* m_acceleratorCallback = nullptr; // basically the same as the key press callback
+		PyObject* m_textureLoadedCallback = nullptr;
 
 	};
 
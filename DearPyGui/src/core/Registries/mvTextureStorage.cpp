@@ -1,6 +1,13 @@
 #include "mvTextureStorage.h"
 #include "mvUtilities.h"
+#include "mvThreadPool.h"
+#include "mvThreadPoolManager.h"
+#include "mvCallbackRegistry.h"
+#include "mvAppLog.h"
+#include "mvApp.h"
 #include <imgui.h>
+#include <stb_image.h>
+#include <cstring>
 
 namespace Marvel {
 
@@ -15,23 +22,33 @@ namespace Marvel {
 		mvEventBus::UnSubscribe(this);
 	}
 
+	mvTextureStorage::DecodedQueue::~DecodedQueue()
+	{
+		for (auto& decoded : textures)
+			stbi_image_free(decoded.data);
+	}
+
 	bool mvTextureStorage::onEvent(mvEvent& event)
 	{
 		mvEventDispatcher dispatcher(event);
 		dispatcher.dispatch(BIND_EVENT_METH(mvTextureStorage::onDecrement), mvEVT_DEC_TEXTURE);
-		dispatcher.dispatch(BIND_EVENT_METH(mvTextureStorage::onFirstFrame), mvEVT_FRAME);
+		dispatcher.dispatch(BIND_EVENT_METH(mvTextureStorage::onFrame), mvEVT_FRAME);
 
 		return event.handled;
 	}
 
-	bool mvTextureStorage::onFirstFrame(mvEvent& event)
+	bool mvTextureStorage::onFrame(mvEvent& event)
 	{
+		uploadDecoded();
+
 		if (GetEInt(event, "FRAME") != 1)
 			return false;
 
 		for (auto& item : m_delayedTextures)
 		{
-			if (item.width > 0u)
+			if (item.width > 0u && IsByteTextureFormat(item.format))
+				addTexture(item.name, item.bytes.data(), item.width, item.height, item.format);
+			else if (item.width > 0u)
 				addTexture(item.name, item.data.data(), item.width, item.height, item.format);
 			else
 				addTexture(item.name);
@@ -54,6 +71,18 @@ namespace Marvel {
 			UnloadTexture(texture.first);
 
 		m_textures.clear();
+
+		for (auto& decoded : m_uploadQueue)
+			stbi_image_free(decoded.data);
+		m_uploadQueue.clear();
+
+		if (m_placeholder.texture)
+		{
+			FreeTexture(m_placeholder);
+			m_placeholder.texture = nullptr;
+		}
+
+		freeAtlasPages();
 	}
 
 	void mvTextureStorage::addTexture(const std::string& name)
@@ -70,8 +99,19 @@ namespace Marvel {
 		if (name == "INTERNAL_DPG_FONT_ATLAS")
 		{
 			m_textures.insert({ name, {ImGui::GetIO().Fonts->TexWidth, ImGui::GetIO().Fonts->TexHeight, ImGui::GetIO().Fonts->TexID, 1} });
+			return;
 		}
 
+		// atlas images are packed once decoded
+		if (m_asyncLoading)
+		{
+			loadTextureAsync(name);
+			return;
+		}
+
+		if (m_atlasMode && addToAtlas(name))
+			return;
+
 		mvTexture newTexture = { 0, 0, nullptr, 1 };
 
 		if (LoadTextureFromFile(name.c_str(), newTexture))
@@ -82,20 +122,93 @@ namespace Marvel {
 	void mvTextureStorage::addTexture(const std::string& name, float* data, unsigned width, unsigned height, mvTextureFormat format)
 	{
 		// check if texture already exists and if it does
-		// just increment its reference count
+		// reuse it when the size and storage match
 		mvTexture* texture = getTexture(name);
-		if (texture)
+		if (texture && !texture->ubyte && texture->width == (int)width && texture->height == (int)height)
 		{
-			UnloadTexture(name);
-			FreeTexture(m_textures.at(name));
-			m_textures.erase(name);
+			if (updateTexture(name, data, 0u, 0u, width, height))
+				return;
 		}
 
-		mvTexture newTexture = { 0, 0, nullptr, 1 };
+		bool replaced = texture != nullptr;
+		mvTexture newTexture = { 0, 0, nullptr, releaseForReplace(name) };
 
 		if (LoadTextureFromArray(name.c_str(), data, width, height, newTexture, format))
+		{
 			m_textures[name] = newTexture;
 
+			// widgets still hold the old handle
+			if (replaced)
+				mvEventBus::Publish(mvEVT_CATEGORY_TEXTURE, mvEVT_TEXTURE_LOADED, { CreateEventArgument("NAME", name) });
+		}
+
+	}
+
+	void mvTextureStorage::addTexture(const std::string& name, unsigned char* data, unsigned width, unsigned height, mvTextureFormat format, bool nearest)
+	{
+		// check if texture already exists and if it does
+		// reuse it when the size, storage and filtering match
+		mvTexture* texture = getTexture(name);
+		if (texture && texture->ubyte && texture->nearest == nearest && texture->width == (int)width && texture->height == (int)height)
+		{
+			if (updateTexture(name, data, 0u, 0u, width, height, format))
+				return;
+		}
+
+		bool replaced = texture != nullptr;
+		mvTexture newTexture = { 0, 0, nullptr, releaseForReplace(name) };
+		newTexture.nearest = nearest;
+
+		if (LoadTextureFromBytes(name.c_str(), data, width, height, newTexture, format))
+		{
+			m_textures[name] = newTexture;
+
+			// widgets still hold the old handle
+			if (replaced)
+				mvEventBus::Publish(mvEVT_CATEGORY_TEXTURE, mvEVT_TEXTURE_LOADED, { CreateEventArgument("NAME", name) });
+		}
+
+	}
+
+	int mvTextureStorage::releaseForReplace(const std::string& name)
+	{
+		// returns the reference count the replacement inherits
+		mvTexture* texture = getTexture(name);
+		if (texture == nullptr)
+			return 1;
+
+		int count = texture->count;
+		UnloadTexture(name);
+		freeTexture(name, *texture);
+		m_textures.erase(name);
+		return count;
+	}
+
+	bool mvTextureStorage::updateTexture(const std::string& name, float* data, unsigned x, unsigned y, unsigned width, unsigned height)
+	{
+		mvTexture* texture = getTexture(name);
+
+		if (texture == nullptr || texture->pending != 0u || texture->atlasPage >= 0 || name == "INTERNAL_DPG_FONT_ATLAS")
+			return false;
+
+		if (texture->ubyte)
+			return false;
+
+		return UpdateTextureFromArray(*texture, data, x, y, width, height);
+	}
+
+	bool mvTextureStorage::updateTexture(const std::string& name, unsigned char* data, unsigned x, unsigned y, unsigned width, unsigned height, mvTextureFormat format)
+	{
+		mvTexture* texture = getTexture(name);
+
+		if (texture == nullptr || texture->pending != 0u || texture->atlasPage >= 0 || name == "INTERNAL_DPG_FONT_ATLAS")
+			return false;
+
+		// natively stored gray textures only accept gray pixels
+		if (!texture->ubyte || (texture->channels == 1u && format != mvTextureFormat::GRAY_UINT8))
+			return false;
+
+		return UpdateTextureFromBytes(*texture, data, x, y, width, height, format);
 	}
 
 	void mvTextureStorage::addDelayedTexture(const std::string& name)
@@ -109,6 +222,11 @@ namespace Marvel {
 		m_delayedTextures.push_back({ name, data, width, height, format });
 	}
 
+	void mvTextureStorage::addDelayedTexture(const std::string& name, std::vector<unsigned char> data, unsigned width, unsigned height, mvTextureFormat format)
+	{
+		m_delayedTextures.push_back({ name, {}, width, height, format, std::move(data) });
+	}
+
 	void mvTextureStorage::incrementTexture(const std::string& name)
 	{
 		// see if texture exists
@@ -131,7 +249,7 @@ namespace Marvel {
 		if (m_textures.at(name).count == 0 && name != "INTERNAL_DPG_FONT_ATLAS")
 		{
 			UnloadTexture(name);
-			FreeTexture(m_textures.at(name));
+			freeTexture(name, m_textures.at(name));
 			m_textures.erase(name);
 
 			mvEventBus::Publish(mvEVT_CATEGORY_TEXTURE, mvEVT_DELETE_TEXTURE, { CreateEventArgument("NAME", name) });
@@ -151,4 +269,314 @@ namespace Marvel {
 		return (unsigned)m_textures.size();
 	}
 
+	static int64_t GetGPUBytes(const mvTexture& texture)
+	{
+		// float data is uploaded as RGBA32F except with opengl,
+		// where the GL_RGBA internal format stores 8 bit channels
+#if defined(__linux__)
+		int64_t channelBytes = 1;
+#else
+		int64_t channelBytes = texture.ubyte ? 1 : 4;
+#endif
+		return (int64_t)texture.width * (int64_t)texture.height * (int64_t)texture.channels * channelBytes;
+	}
+
+	void mvTextureStorage::getMemoryUsage(int64_t& cpu, int64_t& gpu)
+	{
+		cpu = 0;
+		gpu = 0;
+
+		for (const auto& item : m_delayedTextures)
+			cpu += (int64_t)(item.data.capacity() * sizeof(float) + item.bytes.capacity());
+
+		for (const auto& decoded : m_uploadQueue)
+			cpu += (int64_t)decoded.width * (int64_t)decoded.height * 4;
+
+		{
+			std::lock_guard<std::mutex> lock(m_decoded->mutex);
+			for (const auto& decoded : m_decoded->textures)
+				cpu += (int64_t)decoded.width * (int64_t)decoded.height * 4;
+		}
+
+		// headless textures are never uploaded
+		if (mvApp::IsAppHeadless())
+			return;
+
+		// loading textures share the placeholder and atlas
+		// images are counted through their pages
+		for (const auto& texture : m_textures)
+		{
+			if (texture.first == "INTERNAL_DPG_FONT_ATLAS")
+				gpu += (int64_t)texture.second.width * (int64_t)texture.second.height * 4;
+			else if (texture.second.texture && texture.second.pending == 0u && texture.second.atlasPage < 0)
+				gpu += GetGPUBytes(texture.second);
+		}
+
+		for (const auto& page : m_atlasPages)
+		{
+			if (page.texture.texture)
+				gpu += GetGPUBytes(page.texture);
+		}
+
+		if (m_placeholder.texture)
+			gpu += GetGPUBytes(m_placeholder);
+	}
+
+	void mvTextureStorage::freeTexture(const std::string& name, mvTexture& texture)
+	{
+		// textures still loading only reference the shared placeholder
+		// and the font atlas is owned by imgui
+		if (name == "INTERNAL_DPG_FONT_ATLAS")
+			return;
+
+		// atlas pages are released once their last image is
+		if (texture.atlasPage >= 0)
+		{
+			AtlasPage& page = m_atlasPages[texture.atlasPage];
+			page.count--;
+			if (page.count == 0)
+			{
+				FreeTexture(page.texture);
+				page = AtlasPage();
+			}
+			return;
+		}
+
+		if (texture.pending == 0u && texture.texture != m_placeholder.texture)
+			FreeTexture(texture);
+	}
+
+	void mvTextureStorage::setAtlasMode(bool value, int pageSize, int maxImageSize)
+	{
+		m_atlasMode = value;
+
+		// images already packed keep their pages
+		if (m_atlasPages.empty())
+			m_atlasPageSize = pageSize;
+		m_atlasMaxImageSize = maxImageSize < m_atlasPageSize - 2 ? maxImageSize : m_atlasPageSize - 2;
+	}
+
+	unsigned mvTextureStorage::getAtlasPageCount() const
+	{
+		unsigned count = 0u;
+		for (const auto& page : m_atlasPages)
+		{
+			if (page.texture.texture)
+				count++;
+		}
+		return count;
+	}
+
+	bool mvTextureStorage::addToAtlas(const std::string& name)
+	{
+		int width = 0;
+		int height = 0;
+		if (!stbi_info(name.c_str(), &width, &height, nullptr))
+			return false;
+
+		if (width > m_atlasMaxImageSize || height > m_atlasMaxImageSize)
+			return false;
+
+		unsigned char* image_data = stbi_load(name.c_str(), &width, &height, nullptr, 4);
+		if (image_data == nullptr)
+			return false;
+
+		mvTexture newTexture = { width, height, nullptr, 1 };
+		packIntoAtlas(image_data, width, height, newTexture);
+		stbi_image_free(image_data);
+		m_textures.insert({ name, newTexture });
+
+		return true;
+	}
+
+	void mvTextureStorage::packIntoAtlas(const unsigned char* data, int width, int height, mvTexture& texture)
+	{
+		// images get a 1 pixel border copied from their
+		// edges so filtering never samples a neighbor
+		int paddedWidth = width + 2;
+		int paddedHeight = height + 2;
+
+		int pageIndex = -1;
+		int x = 0;
+		int y = 0;
+		for (size_t i = 0; i < m_atlasPages.size() && pageIndex < 0; i++)
+		{
+			AtlasPage& page = m_atlasPages[i];
+			if (page.texture.texture == nullptr)
+				continue;
+
+			x = page.cursorX;
+			y = page.cursorY;
+
+			// start a new shelf
+			if (x + paddedWidth > m_atlasPageSize)
+			{
+				x = 0;
+				y += page.shelfHeight;
+			}
+
+			if (y + paddedHeight <= m_atlasPageSize)
+				pageIndex = (int)i;
+		}
+
+		if (pageIndex < 0)
+		{
+			// reuse a released page before growing
+			for (size_t i = 0; i < m_atlasPages.size() && pageIndex < 0; i++)
+			{
+				if (m_atlasPages[i].texture.texture == nullptr)
+					pageIndex = (int)i;
+			}
+
+			if (pageIndex < 0)
+			{
+				pageIndex = (int)m_atlasPages.size();
+				m_atlasPages.emplace_back();
+			}
+
+			std::vector<unsigned char> blank((size_t)m_atlasPageSize * (size_t)m_atlasPageSize * 4u, 0u);
+			std::string pageName = "INTERNAL_DPG_ATLAS_" + std::to_string(pageIndex);
+			LoadTextureFromPixels(pageName.c_str(), blank.data(), m_atlasPageSize, m_atlasPageSize, m_atlasPages[pageIndex].texture);
+			x = 0;
+			y = 0;
+		}
+
+		AtlasPage& page = m_atlasPages[pageIndex];
+		if (x == 0 && y != page.cursorY)
+			page.shelfHeight = 0;
+
+		std::vector<unsigned char> padded((size_t)paddedWidth * (size_t)paddedHeight * 4u);
+		for (int row = 0; row < paddedHeight; row++)
+		{
+			int sourceRow = row == 0 ? 0 : (row > height ? height - 1 : row - 1);
+			for (int column = 0; column < paddedWidth; column++)
+			{
+				int sourceColumn = column == 0 ? 0 : (column > width ? width - 1 : column - 1);
+				memcpy(&padded[((size_t)row * paddedWidth + column) * 4u], &data[((size_t)sourceRow * width + sourceColumn) * 4u], 4u);
+			}
+		}
+
+		UpdateTextureFromBytes(page.texture, padded.data(), x, y, paddedWidth, paddedHeight, mvTextureFormat::RGBA_UINT8);
+
+		page.cursorX = x + paddedWidth;
+		page.cursorY = y;
+		page.shelfHeight = page.shelfHeight > paddedHeight ? page.shelfHeight : paddedHeight;
+		page.count++;
+
+		float size = (float)m_atlasPageSize;
+		texture.width = width;
+		texture.height = height;
+		texture.texture = page.texture.texture;
+		texture.ubyte = true;
+		texture.channels = 4u;
+		texture.atlasPage = pageIndex;
+		texture.uv_min = { (float)(x + 1) / size, (float)(y + 1) / size };
+		texture.uv_max = { (float)(x + 1 + width) / size, (float)(y + 1 + height) / size };
+	}
+
+	void mvTextureStorage::freeAtlasPages()
+	{
+		for (auto& page : m_atlasPages)
+		{
+			if (page.texture.texture)
+				FreeTexture(page.texture);
+		}
+		m_atlasPages.clear();
+	}
+
+	void mvTextureStorage::loadTextureAsync(const std::string& name)
+	{
+		// only the header is read here so widgets can size themselves
+		// and missing files are still reported immediately
+		int width = 0;
+		int height = 0;
+		if (!stbi_info(name.c_str(), &width, &height, nullptr))
+			return;
+
+		if (m_placeholder.texture == nullptr)
+		{
+			unsigned char transparent[4] = { 0u, 0u, 0u, 0u };
+			LoadTextureFromPixels("INTERNAL_DPG_PLACEHOLDER", transparent, 1u, 1u, m_placeholder);
+		}
+
+		mvTexture newTexture = { width, height, m_placeholder.texture, 1 };
+		newTexture.pending = ++m_lastLoadId;
+		m_textures.insert({ name, newTexture });
+
+		std::shared_ptr<DecodedQueue> queue = m_decoded;
+		unsigned id = newTexture.pending;
+
+		mvThreadPoolManager::GetThreadPoolManager()->getThreadPool()->submit([queue, name, id]()
+			{
+				DecodedTexture decoded = { name, id, 0, 0, nullptr };
+				decoded.data = stbi_load(name.c_str(), &decoded.width, &decoded.height, nullptr, 4);
+
+				{
+					std::lock_guard<std::mutex> lock(queue->mutex);
+					queue->textures.push_back(decoded);
+				}
+
+				// upload happens on the render thread
+				mvApp::RequestFrames();
+			});
+	}
+
+	void mvTextureStorage::uploadDecoded()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_decoded->mutex);
+			for (auto& decoded : m_decoded->textures)
+				m_uploadQueue.push_back(decoded);
+			m_decoded->textures.clear();
+		}
+
+		// at least one texture is uploaded each frame so
+		// images larger than the budget still make progress
+		size_t uploaded = 0u;
+		while (!m_uploadQueue.empty())
+		{
+			DecodedTexture& decoded = m_uploadQueue.front();
+			size_t bytes = (size_t)decoded.width * (size_t)decoded.height * 4u;
+
+			if (uploaded > 0u && uploaded + bytes > m_uploadBudget)
+				break;
+
+			finishTexture(decoded);
+			uploaded += bytes;
+			m_uploadQueue.pop_front();
+		}
+	}
+
+	void mvTextureStorage::finishTexture(DecodedTexture& decoded)
+	{
+		mvTexture* texture = getTexture(decoded.name);
+
+		// texture was released (or replaced) while decoding
+		if (texture == nullptr || texture->pending != decoded.id)
+		{
+			stbi_image_free(decoded.data);
+			return;
+		}
+
+		texture->pending = 0u;
+
+		if (decoded.data == nullptr)
+		{
+			mvAppLog::LogError("Image " + decoded.name + " could not be decoded.");
+			return;
+		}
+
+		// small images join an atlas page once decoded
+		if (m_atlasMode && decoded.width <= m_atlasMaxImageSize && decoded.height <= m_atlasMaxImageSize)
+			packIntoAtlas(decoded.data, decoded.width, decoded.height, *texture);
+		else
+			LoadTextureFromPixels(decoded.name.c_str(), decoded.data, decoded.width, decoded.height, *texture);
+		stbi_image_free(decoded.data);
+
+		mvEventBus::Publish(mvEVT_CATEGORY_TEXTURE, mvEVT_TEXTURE_LOADED, { CreateEventArgument("NAME", decoded.name) });
+
+		if (PyObject* callback = mvCallbackRegistry::GetCallbackRegistry()->getTextureLoadedCallback())
+			mvCallbackRegistry::GetCallbackRegistry()->addCallback(callback, decoded.name, nullptr);
+	}
+
 }
\ No newline at end of file
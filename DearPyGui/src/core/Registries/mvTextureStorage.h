@@ -11,13 +11,32 @@
 //           a reference counting system.
 //
 //     - AddTexture will increment an existing texture if it already exists
+//
+//     - Adding data to an existing texture of the same size (or calling
+//       UpdateTexture) writes into the existing GPU texture instead of
+//       recreating it, so widgets keep their handles.
+//
+//     - When asynchronous loading is turned on, files are decoded on the
+//       thread pool. A placeholder is used until the decoded pixels are
+//       uploaded (limited to a byte budget per frame), after which
+//       mvEVT_TEXTURE_LOADED is published.
+//
+//     - When atlas mode is turned on, small image files are packed into
+//       shared atlas pages so widgets using them can be batched into the
+//       same draw call. The mvTexture then holds the page's texture and
+//       the uv rectangle of the image within it. With asynchronous loading
+//       the image is packed when its decoded pixels are uploaded.
 //     
 //-----------------------------------------------------------------------------
 
 #include <string>
 #include <vector>
+#include <deque>
+#include <mutex>
+#include <memory>
 #include <unordered_map>
 #include "mvEvents.h"
+#include "mvCore.h"
 
 namespace Marvel {
 
@@ -30,16 +49,48 @@ namespace Marvel {
 		int   height = 0;
 		void* texture = nullptr;
 		int   count = 0;
+		unsigned pending = 0; // id of the in-flight asynchronous load (0 if none)
+		bool  ubyte = false;  // stored with 8 bits per channel instead of floats
+		unsigned channels = 4u; // 1 when gray pixels are stored natively
+		bool  nearest = false; // sampled without filtering (OpenGL, other backends share one linear sampler)
+		int   atlasPage = -1; // index of the atlas page holding the image
+		mvVec2 uv_min = { 0.0f, 0.0f }; // area of the image within texture
+		mvVec2 uv_max = { 1.0f, 1.0f };
 	};
 
+	// maps a uv relative to an image into the texture holding it
+	inline mvVec2 MapTextureUV(const mvVec2& textureMin, const mvVec2& textureMax, const mvVec2& uv)
+	{
+		return { textureMin.x + uv.x * (textureMax.x - textureMin.x), textureMin.y + uv.y * (textureMax.y - textureMin.y) };
+	}
+
+	// *_UINT8 formats are uploaded as unsigned bytes
+	// without being converted to floats
 	enum class mvTextureFormat
 	{
 		RGBA_INT = 0u,
 		RGBA_FLOAT,
 		RGB_FLOAT,
-		RGB_INT
+		RGB_INT,
+		RGBA_UINT8,
+		RGB_UINT8,
+		GRAY_UINT8
 	};
 
+	inline bool     IsTextureFormat     (int format) { return format >= (int)mvTextureFormat::RGBA_INT && format <= (int)mvTextureFormat::GRAY_UINT8; }
+	inline bool     IsByteTextureFormat (mvTextureFormat format) { return format >= mvTextureFormat::RGBA_UINT8 && format <= mvTextureFormat::GRAY_UINT8; }
+	inline unsigned GetTextureFormatSize(mvTextureFormat format)
+	{
+		switch (format)
+		{
+		case mvTextureFormat::RGB_FLOAT:
+		case mvTextureFormat::RGB_INT:
+		case mvTextureFormat::RGB_UINT8:  return 3u;
+		case mvTextureFormat::GRAY_UINT8: return 1u;
+		default:                          return 4u;
+		}
+	}
+
 	//-----------------------------------------------------------------------------
 	// mvTextureStorage
 	//-----------------------------------------------------------------------------
@@ -53,6 +104,36 @@ namespace Marvel {
 			unsigned width;
 			unsigned height;
 			mvTextureFormat format;
+			std::vector<unsigned char> bytes; // *_UINT8 formats
+		};
+
+		struct DecodedTexture
+		{
+			std::string    name;
+			unsigned       id;
+			int            width;
+			int            height;
+			unsigned char* data; // RGBA, nullptr if decoding failed
+		};
+
+		// shelf packed page of small images
+		struct AtlasPage
+		{
+			mvTexture texture;
+			int       cursorX = 0;
+			int       cursorY = 0;
+			int       shelfHeight = 0;
+			int       count = 0;
+		};
+
+		// shared with the decoding tasks so late results
+		// never touch a destroyed storage
+		struct DecodedQueue
+		{
+			~DecodedQueue();
+
+			std::mutex                  mutex;
+			std::vector<DecodedTexture> textures;
 		};
 
 	public:
@@ -61,24 +142,61 @@ namespace Marvel {
 		~mvTextureStorage();
 
 		bool onEvent     (mvEvent& event) override;
-		bool onFirstFrame(mvEvent& event);
+		bool onFrame     (mvEvent& event);
 		bool onDecrement (mvEvent& event);
 
 		void       addTexture       (const std::string& name);
 		void       addTexture       (const std::string& name, float* data, unsigned width, unsigned height, mvTextureFormat format);
+		void       addTexture       (const std::string& name, unsigned char* data, unsigned width, unsigned height, mvTextureFormat format, bool nearest = false);
+		bool       updateTexture    (const std::string& name, float* data, unsigned x, unsigned y, unsigned width, unsigned height);
+		bool       updateTexture    (const std::string& name, unsigned char* data, unsigned x, unsigned y, unsigned width, unsigned height, mvTextureFormat format);
 		void       addDelayedTexture(const std::string& name);
 		void       addDelayedTexture(const std::string& name, std::vector<float> data, unsigned width, unsigned height, mvTextureFormat format);
+		void       addDelayedTexture(const std::string& name, std::vector<unsigned char> data, unsigned width, unsigned height, mvTextureFormat format);
 		void       incrementTexture (const std::string& name);
 		void       decrementTexture (const std::string& name);
 		mvTexture* getTexture       (const std::string& name);
 		unsigned   getTextureCount  ();
+		void       getMemoryUsage   (int64_t& cpu, int64_t& gpu); // bytes waiting for upload, estimated bytes on the GPU
 		void       deleteAllTextures();
 
+		void       setAsyncLoading  (bool value) { m_asyncLoading = value; }
+		void       setUploadBudget  (unsigned bytes) { m_uploadBudget = bytes; }
+		bool       isAsyncLoading   () const { return m_asyncLoading; }
+		unsigned   getUploadBudget  () const { return m_uploadBudget; }
+
+		void       setAtlasMode     (bool value, int pageSize, int maxImageSize);
+		bool       isAtlasMode      () const { return m_atlasMode; }
+		unsigned   getAtlasPageCount() const;
+
 	private:
+
+		void       loadTextureAsync (const std::string& name);
+		void       uploadDecoded    ();
+		void       finishTexture    (DecodedTexture& decoded);
+		void       freeTexture      (const std::string& name, mvTexture& texture);
+		int        releaseForReplace(const std::string& name);
+		bool       addToAtlas       (const std::string& name);
+		void       packIntoAtlas    (const unsigned char* data, int width, int height, mvTexture& texture); // RGBA
+		void       freeAtlasPages   ();
 		
 		std::unordered_map<std::string, mvTexture> m_textures;
 		std::vector<CompileTimeTexture>            m_delayedTextures;
 
+		// asynchronous loading
+		bool                                       m_asyncLoading = false;
+		unsigned                                   m_uploadBudget = 4u * 1024u * 1024u; // bytes per frame
+		unsigned                                   m_lastLoadId = 0u;
+		mvTexture                                  m_placeholder;
+		std::shared_ptr<DecodedQueue>              m_decoded = std::make_shared<DecodedQueue>();
+		std::deque<DecodedTexture>                 m_uploadQueue;
+
+		// atlas packing
+		bool                                       m_atlasMode = false;
+		int                                        m_atlasPageSize = 1024;
+		int                                        m_atlasMaxImageSize = 128;
+		std::vector<AtlasPage>                     m_atlasPages;
+
 	};
 
 }
\ No newline at end of file
@@ -83,7 +83,7 @@ namespace Marvel {
 		return true;
 	}
 
-	PyObject* mvValueStorage::GetPyValue(const std::string& name)
+	PyObject* mvValueStorage::GetPyValue(const std::string& name, bool buffer)
 	{
 
 		if (!HasValue(name))
@@ -103,25 +103,25 @@ namespace Marvel {
 			return ToPyInt(*GetIntValue(name));
 
 		case mvValueStorage::ValueTypes::Int2:
-			return ToPyIntList(GetInt2Value(name), 2);
+			return buffer ? ToPyBuffer(GetInt2Value(name), 2) : ToPyIntList(GetInt2Value(name), 2);
 
 		case mvValueStorage::ValueTypes::Int3:
-			return ToPyIntList(GetInt3Value(name), 3);
+			return buffer ? ToPyBuffer(GetInt3Value(name), 3) : ToPyIntList(GetInt3Value(name), 3);
 
 		case mvValueStorage::ValueTypes::Int4:
-			return ToPyIntList(GetInt4Value(name), 4);
+			return buffer ? ToPyBuffer(GetInt4Value(name), 4) : ToPyIntList(GetInt4Value(name), 4);
 
 		case mvValueStorage::ValueTypes::Float:
 			return ToPyFloat(*GetFloatValue(name));
 
 		case mvValueStorage::ValueTypes::Float2:
-			return ToPyFloatList(GetFloat2Value(name), 2);
+			return buffer ? ToPyBuffer(GetFloat2Value(name), 2) : ToPyFloatList(GetFloat2Value(name), 2);
 
 		case mvValueStorage::ValueTypes::Float3:
-			return ToPyFloatList(GetFloat3Value(name), 3);
+			return buffer ? ToPyBuffer(GetFloat3Value(name), 3) : ToPyFloatList(GetFloat3Value(name), 3);
 
 		case mvValueStorage::ValueTypes::Float4:
-			return ToPyFloatList(GetFloat4Value(name), 4);
+			return buffer ? ToPyBuffer(GetFloat4Value(name), 4) : ToPyFloatList(GetFloat4Value(name), 4);
 
 		case mvValueStorage::ValueTypes::String:
 			return ToPyString(*GetStringValue(name));
@@ -130,7 +130,7 @@ namespace Marvel {
 			return ToPyBool(*GetBoolValue(name));
 
 		case mvValueStorage::ValueTypes::FloatVect:
-			return ToPyList(*GetFloatVectorValue(name));
+			return buffer ? ToPyBuffer(*GetFloatVectorValue(name)) : ToPyList(*GetFloatVectorValue(name));
 
 		case mvValueStorage::ValueTypes::Time:
 			return ToPyTime(*GetTimeValue(name));
@@ -1006,4 +1006,21 @@ namespace Marvel {
 		}
 	}
 
+	size_t mvValueStorage::getPayloadBytes() const
+	{
+		const size_t inlineCapacity = std::string().capacity();
+
+		size_t bytes = 0u;
+		for (const auto& value : s_floatvects)
+			bytes += value.second.capacity() * sizeof(float);
+
+		for (const auto& value : s_strings)
+		{
+			if (value.second.capacity() > inlineCapacity)
+				bytes += value.second.capacity() + 1u;
+		}
+
+		return bytes;
+	}
+
 }
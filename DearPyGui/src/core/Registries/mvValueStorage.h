@@ -19,6 +19,7 @@
 #include <array>
 #include <vector>
 #include "mvEvents.h"
+#include "mvMemory.h"
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
 
@@ -54,7 +55,7 @@ namespace Marvel {
 		bool onPythonSetEvent(mvEvent& event);
 
 		// python interfacing
-		PyObject*           GetPyValue          (const std::string& name);
+		PyObject*           GetPyValue          (const std::string& name, bool buffer = false); // buffer: memoryview for numeric lists
 		bool                SetPyValue          (const std::string& name, PyObject* value);
 		void                AddPyValue          (const std::string& name, PyObject* value);
 
@@ -96,34 +97,42 @@ namespace Marvel {
 
 		std::mutex& GetMutex() { return s_mutex; }
 
+		// heap bytes held by float vector and string values (the maps
+		// themselves are counted by their allocator)
+		size_t              getPayloadBytes     () const;
+
 	private:
 
-		std::mutex                                            s_mutex;
+		template<typename T>
+		using Map = mvTrackedMap<std::string, T, mvMemoryCategory::ValueStorage>;
+
+		std::mutex                                                s_mutex;
 
-		std::unordered_map<std::string, ValueTypes>           s_typeStorage;  // keeps track of value mapping
-		std::unordered_map<std::string, int>                  s_refStorage;   // keeps track of reference count
-		std::set<std::string>                                 s_itemStorage;  // keeps track of registered items
+		Map<ValueTypes>                                           s_typeStorage;  // keeps track of value mapping
+		Map<int>                                                  s_refStorage;   // keeps track of reference count
+		std::set<std::string, std::less<std::string>,
+			mvTrackedAllocator<std::string, mvMemoryCategory::ValueStorage>> s_itemStorage;  // keeps track of registered items
 
 		// ints
-		std::unordered_map<std::string, int>                  s_ints; 
-		std::unordered_map<std::string, std::array<int, 2>>   s_int2s;
-		std::unordered_map<std::string, std::array<int, 3>>   s_int3s;
-		std::unordered_map<std::string, std::array<int, 4>>   s_int4s;
+		Map<int>                                                  s_ints; 
+		Map<std::array<int, 2>>                                   s_int2s;
+		Map<std::array<int, 3>>                                   s_int3s;
+		Map<std::array<int, 4>>                                   s_int4s;
 
 		// floats
-		std::unordered_map<std::string, float>                s_floats;  
-		std::unordered_map<std::string, std::array<float, 2>> s_float2s; 
-		std::unordered_map<std::string, std::array<float, 3>> s_float3s; 
-		std::unordered_map<std::string, std::array<float, 4>> s_float4s; 
-		std::unordered_map<std::string, std::vector<float>>   s_floatvects;
+		Map<float>                                                s_floats;  
+		Map<std::array<float, 2>>                                 s_float2s; 
+		Map<std::array<float, 3>>                                 s_float3s; 
+		Map<std::array<float, 4>>                                 s_float4s; 
+		Map<std::vector<float>>                                   s_floatvects;
 
 		// other
-		std::unordered_map<std::string, bool>                 s_bools;  
-		std::unordered_map<std::string, std::string>          s_strings;
+		Map<bool>                                                 s_bools;  
+		Map<std::string>                                          s_strings;
 		
 		// time
-		std::unordered_map<std::string, tm>                   s_times;
-		std::unordered_map<std::string, ImPlotTime>           s_imtimes; 
+		Map<tm>                                                   s_times;
+		Map<ImPlotTime>                                           s_imtimes; 
 
 	};
 
@@ -1,6 +1,7 @@
 #include "mvApp.h"
 #include "mvMarvel.h"
 #include "mvWindow.h"
+#include "platform/Headless/mvHeadlessWindow.h"
 #include "mvCore.h"
 #include "mvDataStorage.h"
 #include "mvCallbackRegistry.h"
@@ -16,15 +17,20 @@
 #include "mvAppItems.h"
 #include <frameobject.h>
 #include "mvPyObject.h"
+#include "mvGlobalIntepreterLock.h"
 #include "mvProfiler.h"
+#include "mvCostTracker.h"
+#include "mvFrameStats.h"
 #include <implot.h>
 #include "mvThreadPoolManager.h"
 #include "mvEventListener.h"
 
 namespace Marvel {
 
-	mvApp* mvApp::s_instance = nullptr;
-	bool   mvApp::s_started = false;
+	mvApp*          mvApp::s_instance = nullptr;
+	bool            mvApp::s_started = false;
+	std::atomic_int mvApp::s_framesRequested = 0;
+	bool            mvApp::s_headless = false;
 
 
 	// utility structure for realtime plot
@@ -70,6 +76,9 @@ namespace Marvel {
 			s_instance = nullptr;
 		}
 
+		// the registry outlives the app, its python objects don't need to
+		mvCallbackRegistry::GetCallbackRegistry()->releaseCachedObjects();
+
 		s_started = false;
 	}
 
@@ -92,14 +101,59 @@ namespace Marvel {
 			viewport->stop();
 	}
 
+	void mvApp::RequestFrames(int count)
+	{
+		int requested = s_framesRequested.load();
+		while (requested < count && !s_framesRequested.compare_exchange_weak(requested, count)) {}
+
+		// wake a viewport waiting for events
+		if (requested == 0 && s_instance && s_instance->m_powerSaving && s_instance->m_viewport)
+			s_instance->m_viewport->wake();
+	}
+
+	bool mvApp::isFrameRequested()
+	{
+		// first frames settle layout and run the start callback
+		if (ImGui::GetFrameCount() < 5)
+			return true;
+
+		// render callbacks, queued async work and user interaction need every frame
+		if (mvCallbackRegistry::GetCallbackRegistry()->getRenderCallback() ||
+			mvCallbackRegistry::GetCallbackRegistry()->hasAsyncCallbacks() ||
+			ImGui::IsAnyItemActive() || ImGui::IsAnyMouseDown() || ImGui::GetIO().WantTextInput)
+			return true;
+
+		int requested = s_framesRequested.load();
+		while (requested > 0 && !s_framesRequested.compare_exchange_weak(requested, requested - 1)) {}
+		return requested > 0;
+	}
+
 	void mvApp::start(const std::string& primaryWindow)
 	{
 		s_started = true;
+		s_headless = false;
 
 		// create window
 		m_viewport = mvWindow::CreatemvWindow(m_actualWidth, m_actualHeight, false);
 		m_viewport->show();
 
+		run(primaryWindow);
+	}
+
+	void mvApp::startHeadless(const std::string& primaryWindow, int frames)
+	{
+		s_started = true;
+		s_headless = true;
+
+		m_viewport = new mvHeadlessWindow(m_actualWidth, m_actualHeight, frames);
+
+		// stays set until the next start so textures freed with the app
+		// skip the (absent) renderer too
+		run(primaryWindow);
+	}
+
+	void mvApp::run(const std::string& primaryWindow)
+	{
 		if (!std::string(primaryWindow).empty())
 		{
 			// reset other windows
@@ -119,6 +173,7 @@ namespace Marvel {
 
 		m_viewport->run();
 		delete m_viewport;
+		m_viewport = nullptr;
 		s_started = false;
 	}
 
@@ -127,7 +182,9 @@ namespace Marvel {
 
 		mvEventBus::Subscribe(this, 0, mvEVT_CATEGORY_VIEWPORT);
 
-		m_parsers = BuildDearPyGuiInterface();
+		// built once per process, commands keep references to their parser
+		static std::map<std::string, mvPythonParser>* parsers = BuildDearPyGuiInterface();
+		m_parsers = parsers;
 
 		// info
 		mvAppLog::AddLog("\n");
@@ -136,6 +193,11 @@ namespace Marvel {
 		mvAppLog::AddLog("[DearImGui Version] %0s\n", IMGUI_VERSION);
 
 		m_mainThreadID = std::this_thread::get_id();
+		mvInstrumentor::Get().SetThreadName("Main");
+
+#if defined(MV_PROFILE) && defined(MV_DEBUG)
+		MV_PROFILE_BEGIN_SESSION("DearPyGui");
+#endif // MV_PROFILE
 
 #if defined(MV_DEBUG)
 		new mvEventListener();
@@ -175,6 +237,8 @@ namespace Marvel {
 
 	mvApp::~mvApp()
 	{
+		mvEventBus::UnSubscribe(this);
+
 		m_itemRegistry.clearRegistry();
 
 		mvApp::GetApp()->getTextureStorage().deleteAllTextures();
@@ -192,6 +256,9 @@ namespace Marvel {
 	{
 		MV_PROFILE_FUNCTION();
 
+		mvCostTracker::BeginFrame();
+		mvFrameStats::BeginFrame();
+
 		// update timing
 		m_deltaTime = ImGui::GetIO().DeltaTime;
 		m_time = ImGui::GetTime();
@@ -221,10 +288,25 @@ namespace Marvel {
 		// route input callbacks
 		mvInput::CheckInputs();
 
-		mvEventBus::Publish(mvEVT_CATEGORY_APP, mvEVT_PRE_RENDER);
-		mvEventBus::Publish(mvEVT_CATEGORY_APP, mvEVT_PRE_RENDER_RESET);
-		mvEventBus::Publish(mvEVT_CATEGORY_APP, mvEVT_RENDER);
-		mvEventBus::Publish(mvEVT_CATEGORY_APP, mvEVT_END_FRAME);
+		{
+			mvFrameStatsScope phase(mvFramePhase::PreRender);
+			mvEventBus::Publish(mvEVT_CATEGORY_APP, mvEVT_PRE_RENDER);
+			mvEventBus::Publish(mvEVT_CATEGORY_APP, mvEVT_PRE_RENDER_RESET);
+		}
+
+		{
+			mvFrameStatsScope phase(mvFramePhase::Render);
+			mvEventBus::Publish(mvEVT_CATEGORY_APP, mvEVT_RENDER);
+		}
+
+		{
+			mvFrameStatsScope phase(mvFramePhase::EndFrame);
+			mvEventBus::Publish(mvEVT_CATEGORY_APP, mvEVT_END_FRAME);
+		}
+
+		mvCostTracker::EndFrame();
+		mvGlobalIntepreterLock::EndFrame();
+		mvInstrumentor::Get().EndFrame();
 
 #if defined(MV_PROFILE) && defined(MV_DEBUG)
 		postProfile();
@@ -20,6 +20,7 @@
 #include <string>
 #include <queue>
 #include <thread>
+#include <atomic>
 #include "mvEvents.h"
 #include "mvAppItem.h"
 #include "mvPythonParser.h"
@@ -54,6 +55,7 @@ namespace Marvel {
         friend class mvWindowsWindow;
         friend class mvLinuxWindow;
         friend class mvAppleWindow;
+        friend class mvHeadlessWindow;
 
     public:
 
@@ -68,8 +70,11 @@ namespace Marvel {
         static bool              IsAppStarted        () { return s_started; }
         static void              SetAppStarted       ();
         static void              SetAppStopped       ();
+        static void              RequestFrames       (int count = 3); // thread safe
+        static bool              IsAppHeadless       () { return s_headless; }
 
         void start(const std::string& primaryWindow);
+        void startHeadless(const std::string& primaryWindow, int frames); // null renderer, frames = 0 runs until stopped
 
         ~mvApp();
 
@@ -102,6 +107,7 @@ namespace Marvel {
         void                     setGlobalFontScale(float scale);
         void                     setViewport       (mvWindow* viewport) { m_viewport = viewport; }
         void                     setTitle          (const std::string& title) { m_title = title; }
+        void                     setPowerSaving    (bool value, float maxIdle) { m_powerSaving = value; m_maxIdleTime = maxIdle; }
         void                     setFont(const std::string& file, float size = 13.0f, const std::string& glyphRange = "",
                                     std::vector<std::array<ImWchar, 3>> customRanges = {},
                                     std::vector<ImWchar> chars= {});
@@ -116,6 +122,12 @@ namespace Marvel {
         mvWindow*                getViewport       ()       { return m_viewport; }
         bool                     getVSync          () const { return m_vsync; }
         bool                     getResizable      () const { return m_resizable; }
+        bool                     getPowerSaving    () const { return m_powerSaving; }
+        float                    getMaxIdleTime    () const { return m_maxIdleTime; }
+
+        // power saving: true when the next frame should render without
+        // waiting for events (consumes one requested frame)
+        bool                     isFrameRequested  ();
         
         //-----------------------------------------------------------------------------
         // Styles/Themes
@@ -151,14 +163,18 @@ namespace Marvel {
         //-----------------------------------------------------------------------------
         void postProfile    ();
 
+        void run(const std::string& primaryWindow); // shared by start and startHeadless
+
         mvApp();
 
         void updateStyle();
         
     private:
 
-        static mvApp* s_instance;
-        static bool   s_started;
+        static mvApp*           s_instance;
+        static bool             s_started;
+        static std::atomic_int  s_framesRequested;
+        static bool             s_headless;
 
         // managers
         mvItemRegistry                         m_itemRegistry;
@@ -188,6 +204,10 @@ namespace Marvel {
         bool        m_vsync = true;
         bool        m_resizable = true;
 
+        // power saving (viewport waits for events between requested frames)
+        bool        m_powerSaving = false;
+        float       m_maxIdleTime = 1.0f; // seconds between frames while idle
+
         // fonts
         std::string                         m_fontFile;
         std::string                         m_fontGlyphRange;
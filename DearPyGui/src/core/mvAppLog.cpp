@@ -108,6 +108,11 @@ namespace Marvel {
 		s_focus = true;
 	}
 	
+	size_t mvAppLog::GetBufferBytes()
+	{
+		return (size_t)Buf.Buf.Capacity + (size_t)LineOffsets.Capacity * sizeof(int);
+	}
+
 	void mvAppLog::Clear()
 	{
 		Buf.clear();
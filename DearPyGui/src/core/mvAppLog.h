@@ -36,6 +36,7 @@ namespace Marvel {
 		static void                   SetConfigDict(PyObject* dict);
 		static void                   GetConfigDict(PyObject* dict);
 		static void                   Focus          ();
+		static size_t                 GetBufferBytes ();
 
 	private:
 
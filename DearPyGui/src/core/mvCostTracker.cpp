@@ -0,0 +1,140 @@
+#include "mvCostTracker.h"
+#include <algorithm>
+
+namespace Marvel {
+
+	int                                                        mvCostTracker::s_interval = 0;
+	int                                                        mvCostTracker::s_frame = 0;
+	std::atomic_bool                                           mvCostTracker::s_sampling = false;
+	std::thread::id                                            mvCostTracker::s_thread;
+	std::unordered_map<std::string, mvCostTracker::FrameEntry> mvCostTracker::s_current;
+	std::vector<std::unordered_map<std::string, mvCostTracker::FrameEntry>> mvCostTracker::s_frames;
+	int                                                        mvCostTracker::s_next = 0;
+	mvCostScope*                                               mvCostScope::s_current = nullptr;
+
+	void mvCostTracker::SetSampleInterval(int frames)
+	{
+		s_interval = frames > 0 ? frames : 0;
+		s_frame = 0;
+	}
+
+	void mvCostTracker::Reset()
+	{
+		s_frames.clear();
+		s_current.clear();
+		s_next = 0;
+	}
+
+	void mvCostTracker::BeginFrame()
+	{
+		if (s_interval == 0)
+		{
+			s_sampling = false;
+			return;
+		}
+
+		s_thread = std::this_thread::get_id();
+		s_sampling = s_frame++ % s_interval == 0;
+	}
+
+	void mvCostTracker::EndFrame()
+	{
+		if (!IsSampling())
+			return;
+
+		s_sampling = false;
+
+		if (s_frames.size() < FrameCapacity)
+			s_frames.emplace_back();
+
+		// reuse the oldest slot's buckets
+		auto& slot = s_frames[s_next];
+		slot.clear();
+		slot.swap(s_current);
+		s_next = (s_next + 1) % FrameCapacity;
+	}
+
+	void mvCostTracker::Record(const std::string& name, mvCostType type, double time)
+	{
+		auto& entry = s_current.try_emplace(name, FrameEntry{ type, 0.0, 0 }).first->second;
+		entry.time += time;
+		entry.calls++;
+	}
+
+	std::vector<mvCost> mvCostTracker::GetBreakdown(int top)
+	{
+		std::unordered_map<std::string, mvCost> totals;
+
+		for (const auto& frame : s_frames)
+		{
+			for (const auto& item : frame)
+			{
+				mvCost& cost = totals[item.first];
+				cost.type = item.second.type;
+				cost.average += item.second.time;
+				cost.max = std::max(cost.max, item.second.time);
+				cost.calls += item.second.calls;
+				cost.frames++;
+			}
+		}
+
+		std::vector<mvCost> result;
+		result.reserve(totals.size());
+		for (auto& item : totals)
+		{
+			item.second.name = item.first;
+			item.second.average /= (double)s_frames.size();
+			result.push_back(std::move(item.second));
+		}
+
+		std::sort(result.begin(), result.end(),
+			[](const mvCost& a, const mvCost& b) { return a.average > b.average; });
+
+		if (top > 0 && (int)result.size() > top)
+			result.resize(top);
+
+		return result;
+	}
+
+	const char* mvCostTracker::GetTypeName(mvCostType type)
+	{
+		switch (type)
+		{
+		case mvCostType::Series:   return "series";
+		case mvCostType::Callback: return "callback";
+		default:                   return "item";
+		}
+	}
+
+	mvCostScope::mvCostScope(const std::string& name, mvCostType type, const std::string* owner)
+		: m_type(type)
+	{
+		if (!mvCostTracker::IsSampling() || name.empty() || std::this_thread::get_id() != mvCostTracker::s_thread)
+			return;
+
+		m_active = true;
+		m_name = &name;
+		m_owner = owner;
+		m_parent = s_current;
+		s_current = this;
+		m_start = std::chrono::steady_clock::now();
+	}
+
+	mvCostScope::~mvCostScope()
+	{
+		if (!m_active)
+			return;
+
+		double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+
+		s_current = m_parent;
+		if (m_parent)
+			m_parent->m_childTime += elapsed;
+
+		if (m_owner)
+			mvCostTracker::Record(*m_owner + "/" + *m_name, m_type, elapsed - m_childTime);
+		else
+			mvCostTracker::Record(*m_name, m_type, elapsed - m_childTime);
+	}
+
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// mvCostTracker
+//
+//     - Attributes frame time to the items, plot series and python
+//       callbacks that spent it. Every Nth frame is sampled, the rest
+//       only pay for a flag check.
+//
+//     - Times are self times: a container's cost excludes the children
+//       drawn inside it, so the top entries point at the actual culprit.
+//
+//     - The last FrameCapacity sampled frames are kept in a ring buffer.
+//
+//-----------------------------------------------------------------------------
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unordered_map>
+
+namespace Marvel {
+
+	enum class mvCostType
+	{
+		Item, Series, Callback
+	};
+
+	struct mvCost
+	{
+		std::string name;
+		mvCostType  type = mvCostType::Item;
+		double      average = 0.0; // ms per sampled frame
+		double      max = 0.0;     // worst sampled frame (ms)
+		int         calls = 0;     // over all kept frames
+		int         frames = 0;    // sampled frames it appeared in
+	};
+
+	//-----------------------------------------------------------------------------
+	// mvCostTracker
+	//-----------------------------------------------------------------------------
+	class mvCostTracker
+	{
+
+		friend class mvCostScope;
+
+		struct FrameEntry
+		{
+			mvCostType type;
+			double     time;
+			int        calls;
+		};
+
+	public:
+
+		static constexpr int FrameCapacity = 64;
+
+		// 0 disables sampling
+		static void SetSampleInterval(int frames);
+		static int  GetSampleInterval() { return s_interval; }
+		static void Reset();
+
+		// called by mvApp around each frame (main thread)
+		static void BeginFrame();
+		static void EndFrame();
+
+		static bool IsSampling() { return s_sampling.load(std::memory_order_relaxed); }
+
+		// sorted by average self time, top <= 0 returns everything
+		static std::vector<mvCost> GetBreakdown(int top = 0);
+
+		static const char* GetTypeName(mvCostType type);
+
+	private:
+
+		static void Record(const std::string& name, mvCostType type, double time);
+
+	private:
+
+		static int                                                  s_interval;
+		static int                                                  s_frame;
+		static std::atomic_bool                                     s_sampling;
+		static std::thread::id                                      s_thread;
+		static std::unordered_map<std::string, FrameEntry>          s_current;
+		static std::vector<std::unordered_map<std::string, FrameEntry>> s_frames;
+		static int                                                  s_next;
+
+	};
+
+	//-----------------------------------------------------------------------------
+	// mvCostScope
+	//     - charges its lifetime (minus nested scopes) to name
+	//-----------------------------------------------------------------------------
+	class mvCostScope
+	{
+
+	public:
+
+		mvCostScope(const std::string& name, mvCostType type = mvCostType::Item, const std::string* owner = nullptr);
+		~mvCostScope();
+
+		mvCostScope(const mvCostScope& other) = delete;
+		mvCostScope& operator=(const mvCostScope& other) = delete;
+
+	private:
+
+		bool                                               m_active = false;
+		const std::string*                                 m_name = nullptr;
+		const std::string*                                 m_owner = nullptr;
+		mvCostType                                         m_type;
+		double                                             m_childTime = 0.0;
+		mvCostScope*                                       m_parent = nullptr;
+		std::chrono::time_point<std::chrono::steady_clock> m_start;
+
+		static mvCostScope* s_current;
+
+	};
+
+}
@@ -49,4 +49,5 @@
 // mvEVT_CATEGORY_TEXTURE Events
 //-----------------------------------------------------------------------------
 #define mvEVT_DEC_TEXTURE       SID("DECREMENT_TEXTURE")
-#define mvEVT_DELETE_TEXTURE    SID("DELETE_TEXTURE")
\ No newline at end of file
+#define mvEVT_DELETE_TEXTURE    SID("DELETE_TEXTURE")
+#define mvEVT_TEXTURE_LOADED    SID("TEXTURE_LOADED")
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include "mvFrameStats.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Marvel {
+
+	std::mutex                                         mvFrameStats::s_mutex;
+	mvFrameHistogram                                   mvFrameStats::s_histograms[(int)mvFramePhase::Count];
+	std::chrono::time_point<std::chrono::steady_clock> mvFrameStats::s_lastFrame;
+	bool                                               mvFrameStats::s_idle = true;
+	uint64_t                                           mvFrameStats::s_dropped = 0;
+	float                                              mvFrameStats::s_targetFps = 60.0f;
+
+	//-----------------------------------------------------------------------------
+	// mvFrameHistogram
+	//-----------------------------------------------------------------------------
+	static int BucketIndex(uint64_t value)
+	{
+		int msb = 0;
+		for (uint64_t v = value; v > 1; v >>= 1)
+			msb++;
+
+		int shift = std::max(0, msb - mvFrameHistogram::SubBucketBits);
+		if (shift > mvFrameHistogram::MaxShift)
+			return mvFrameHistogram::BucketCount - 1;
+
+		return (shift << mvFrameHistogram::SubBucketBits) + (int)(value >> shift);
+	}
+
+	// middle of the bucket's value range
+	static double BucketValue(int index)
+	{
+		constexpr int half = 1 << mvFrameHistogram::SubBucketBits;
+
+		if (index < 2 * half)
+			return (double)index;
+
+		int shift = index / half - 1;
+		uint64_t lower = (uint64_t)(index - shift * half) << shift;
+		return (double)lower + ((1ull << shift) - 1) / 2.0;
+	}
+
+	void mvFrameHistogram::record(uint64_t microseconds)
+	{
+		m_buckets[BucketIndex(microseconds)]++;
+		m_count++;
+		m_sum += (double)microseconds;
+		m_max = std::max(m_max, microseconds);
+	}
+
+	void mvFrameHistogram::reset()
+	{
+		std::fill(std::begin(m_buckets), std::end(m_buckets), 0);
+		m_count = 0;
+		m_max = 0;
+		m_sum = 0.0;
+	}
+
+	double mvFrameHistogram::percentile(double p) const
+	{
+		if (m_count == 0)
+			return 0.0;
+
+		uint64_t target = (uint64_t)std::ceil(p / 100.0 * (double)m_count);
+		target = std::max<uint64_t>(target, 1);
+
+		uint64_t seen = 0;
+		for (int i = 0; i < BucketCount; i++)
+		{
+			seen += m_buckets[i];
+			if (seen >= target)
+				return i == BucketCount - 1 ? getMax() : std::min(BucketValue(i), (double)m_max) / 1000.0;
+		}
+
+		return getMax();
+	}
+
+	//-----------------------------------------------------------------------------
+	// mvFrameStats
+	//-----------------------------------------------------------------------------
+	void mvFrameStats::BeginFrame()
+	{
+		auto now = std::chrono::steady_clock::now();
+
+		std::lock_guard<std::mutex> lock(s_mutex);
+
+		if (!s_idle)
+		{
+			uint64_t interval = std::chrono::duration_cast<std::chrono::microseconds>(now - s_lastFrame).count();
+			s_histograms[(int)mvFramePhase::Frame].record(interval);
+
+			if ((double)interval > 1.5e6 / s_targetFps)
+				s_dropped++;
+		}
+
+		s_lastFrame = now;
+		s_idle = false;
+	}
+
+	void mvFrameStats::MarkIdle()
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+		s_idle = true;
+	}
+
+	void mvFrameStats::Record(mvFramePhase phase, std::chrono::steady_clock::duration duration)
+	{
+		uint64_t value = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+
+		std::lock_guard<std::mutex> lock(s_mutex);
+		s_histograms[(int)phase].record(value);
+	}
+
+	void mvFrameStats::Reset(float targetFps)
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+
+		for (auto& histogram : s_histograms)
+			histogram.reset();
+
+		s_dropped = 0;
+		s_idle = true;
+		s_targetFps = targetFps > 0.0f ? targetFps : 60.0f;
+	}
+
+	mvFrameStats::Summary mvFrameStats::GetSummary(mvFramePhase phase)
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+
+		const mvFrameHistogram& histogram = s_histograms[(int)phase];
+
+		Summary summary;
+		summary.p50 = histogram.percentile(50.0);
+		summary.p95 = histogram.percentile(95.0);
+		summary.p99 = histogram.percentile(99.0);
+		summary.max = histogram.getMax();
+		summary.mean = histogram.getMean();
+		summary.count = histogram.getCount();
+		return summary;
+	}
+
+	uint64_t mvFrameStats::GetDroppedFrames()
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+		return s_dropped;
+	}
+
+	float mvFrameStats::GetTargetFps()
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+		return s_targetFps;
+	}
+
+	const char* mvFrameStats::GetPhaseName(mvFramePhase phase)
+	{
+		switch (phase)
+		{
+		case mvFramePhase::Frame:     return "frame";
+		case mvFramePhase::PreRender: return "pre_render";
+		case mvFramePhase::Render:    return "render";
+		case mvFramePhase::EndFrame:  return "end_frame";
+		case mvFramePhase::Present:   return "present";
+		default:                      return "unknown";
+		}
+	}
+
+}
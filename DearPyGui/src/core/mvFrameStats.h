@@ -0,0 +1,126 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// mvFrameStats
+//
+//     - Collects frame timings into log-linear (HDR style) histograms:
+//       values below 64µs get exact buckets, above that each power of two
+//       is split into 32 buckets, so percentiles are within ~3%.
+//
+//     - Frame is the interval between frame starts. The other phases
+//       time the frame's event publishes and the viewport's present.
+//       Intervals ending a power saving wait are not recorded.
+//
+//-----------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace Marvel {
+
+	enum class mvFramePhase
+	{
+		Frame, PreRender, Render, EndFrame, Present, Count
+	};
+
+	//-----------------------------------------------------------------------------
+	// mvFrameHistogram
+	//-----------------------------------------------------------------------------
+	class mvFrameHistogram
+	{
+
+	public:
+
+		static constexpr int SubBucketBits = 5;
+		static constexpr int MaxShift      = 21; // ~67 s
+		static constexpr int BucketCount   = (MaxShift + 2) << SubBucketBits;
+
+	public:
+
+		void   record    (uint64_t microseconds);
+		void   reset     ();
+
+		// milliseconds
+		double percentile(double p) const;
+		double getMax    () const { return m_max / 1000.0; }
+		double getMean   () const { return m_count ? m_sum / 1000.0 / m_count : 0.0; }
+		uint64_t getCount() const { return m_count; }
+
+	private:
+
+		uint32_t m_buckets[BucketCount] = {};
+		uint64_t m_count = 0;
+		uint64_t m_max   = 0;
+		double   m_sum   = 0.0;
+
+	};
+
+	//-----------------------------------------------------------------------------
+	// mvFrameStats
+	//-----------------------------------------------------------------------------
+	class mvFrameStats
+	{
+
+	public:
+
+		struct Summary
+		{
+			double   p50  = 0.0;
+			double   p95  = 0.0;
+			double   p99  = 0.0;
+			double   max  = 0.0;
+			double   mean = 0.0;
+			uint64_t count = 0;
+		};
+
+	public:
+
+		// called by mvApp at the start of each frame
+		static void BeginFrame();
+
+		// the viewport slept waiting for input, don't count the next interval
+		static void MarkIdle();
+
+		static void Record(mvFramePhase phase, std::chrono::steady_clock::duration duration);
+
+		// frames slower than 1.5x the target interval count as dropped
+		static void Reset(float targetFps = 60.0f);
+
+		static Summary     GetSummary      (mvFramePhase phase);
+		static uint64_t    GetDroppedFrames();
+		static float       GetTargetFps    ();
+		static const char* GetPhaseName    (mvFramePhase phase);
+
+	private:
+
+		static std::mutex                                         s_mutex;
+		static mvFrameHistogram                                   s_histograms[(int)mvFramePhase::Count];
+		static std::chrono::time_point<std::chrono::steady_clock> s_lastFrame;
+		static bool                                               s_idle;
+		static uint64_t                                           s_dropped;
+		static float                                              s_targetFps;
+
+	};
+
+	//-----------------------------------------------------------------------------
+	// mvFrameStatsScope
+	//-----------------------------------------------------------------------------
+	class mvFrameStatsScope
+	{
+
+	public:
+
+		mvFrameStatsScope(mvFramePhase phase)
+			: m_phase(phase), m_start(std::chrono::steady_clock::now()) {}
+
+		~mvFrameStatsScope() { mvFrameStats::Record(m_phase, std::chrono::steady_clock::now() - m_start); }
+
+	private:
+
+		mvFramePhase                                       m_phase;
+		std::chrono::time_point<std::chrono::steady_clock> m_start;
+
+	};
+
+}
@@ -0,0 +1,160 @@
+#include "mvIdentifier.h"
+#include <deque>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Marvel {
+
+	// function statics so identifiers can be created during static initialization
+	struct mvStringTable
+	{
+		std::mutex                                     mutex;
+		std::deque<std::string>                        strings = { "" }; // stable addresses, index is the id
+		std::unordered_map<std::string_view, uint32_t> ids = { {std::string_view(), 0u} };
+		std::vector<uint32_t>                          refs = { 1u };    // items using each entry
+		std::vector<bool>                              candidate = { false };
+		std::vector<uint32_t>                          candidates;       // entries that may be unused
+		std::vector<uint32_t>                          freeIds;          // released entries to reuse
+		size_t                                         bytes = 0;        // characters held
+	};
+
+	static void AddCandidate(mvStringTable& table, uint32_t id)
+	{
+		if (table.candidate[id])
+			return;
+		table.candidate[id] = true;
+		table.candidates.push_back(id);
+	}
+
+	static mvStringTable& GetStringTable()
+	{
+		static mvStringTable table;
+		return table;
+	}
+
+	static uint32_t Intern(std::string_view name)
+	{
+		if (name.empty())
+			return 0u;
+
+		mvStringTable& table = GetStringTable();
+		std::lock_guard<std::mutex> lock(table.mutex);
+
+		auto found = table.ids.find(name);
+		if (found != table.ids.end())
+			return found->second;
+
+		uint32_t id;
+		if (table.freeIds.empty())
+		{
+			id = (uint32_t)table.strings.size();
+			table.strings.emplace_back(name);
+			table.refs.push_back(0u);
+			table.candidate.push_back(false);
+		}
+		else
+		{
+			id = table.freeIds.back();
+			table.freeIds.pop_back();
+			table.strings[id] = name;
+		}
+
+		table.ids.emplace(table.strings[id], id);
+		table.bytes += name.size();
+
+		// released by Compact unless an item retains it first
+		AddCandidate(table, id);
+		return id;
+	}
+
+	mvIdentifier::mvIdentifier(const std::string& name)
+		: m_id(Intern(name))
+	{
+	}
+
+	mvIdentifier::mvIdentifier(const char* name)
+		: m_id(name ? Intern(name) : 0u)
+	{
+	}
+
+	mvIdentifier mvIdentifier::Find(const std::string& name)
+	{
+		mvIdentifier identifier;
+		if (name.empty())
+			return identifier;
+
+		mvStringTable& table = GetStringTable();
+		std::lock_guard<std::mutex> lock(table.mutex);
+
+		auto found = table.ids.find(name);
+		if (found != table.ids.end())
+			identifier.m_id = found->second;
+		return identifier;
+	}
+
+	void mvIdentifier::Retain(mvIdentifier identifier)
+	{
+		if (identifier.empty())
+			return;
+
+		mvStringTable& table = GetStringTable();
+		std::lock_guard<std::mutex> lock(table.mutex);
+		table.refs[identifier.m_id]++;
+	}
+
+	void mvIdentifier::Release(mvIdentifier identifier)
+	{
+		if (identifier.empty())
+			return;
+
+		mvStringTable& table = GetStringTable();
+		std::lock_guard<std::mutex> lock(table.mutex);
+		if (--table.refs[identifier.m_id] == 0u)
+			AddCandidate(table, identifier.m_id);
+	}
+
+	size_t mvIdentifier::Compact()
+	{
+		mvStringTable& table = GetStringTable();
+		std::lock_guard<std::mutex> lock(table.mutex);
+
+		size_t released = 0;
+		for (uint32_t id : table.candidates)
+		{
+			table.candidate[id] = false;
+			if (table.refs[id] != 0u)
+				continue;
+
+			table.bytes -= table.strings[id].size();
+			table.ids.erase(table.strings[id]);
+			std::string().swap(table.strings[id]);
+			table.freeIds.push_back(id);
+			released++;
+		}
+		table.candidates.clear();
+
+		return released;
+	}
+
+	void mvIdentifier::GetTableStats(size_t& entries, size_t& bytes)
+	{
+		mvStringTable& table = GetStringTable();
+		std::lock_guard<std::mutex> lock(table.mutex);
+
+		entries = table.ids.size() - 1u;
+
+		// characters plus the per entry bookkeeping
+		bytes = table.bytes + table.strings.size() * (sizeof(std::string) + sizeof(uint32_t))
+			+ table.ids.size() * (sizeof(std::string_view) + sizeof(uint32_t) + 2u * sizeof(void*));
+	}
+
+	const std::string& mvIdentifier::getString() const
+	{
+		mvStringTable& table = GetStringTable();
+		std::lock_guard<std::mutex> lock(table.mutex);
+		return table.strings[m_id];
+	}
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// mvIdentifier
+//
+//     - Interned name used for item identity inside the registry. Each
+//       distinct name is stored once in a global string table and the
+//       identifier is its 32 bit index, so comparing and hashing are
+//       integer operations and queued operations are trivially copyable.
+//
+//     - Id 0 is the empty name. Find looks a name up without interning
+//       it; a name that was never interned can't belong to an item.
+//
+//     - Items retain the entry of their name. Entries no item retains are
+//       released by Compact and their ids reused, so Compact may only run
+//       when no identifiers are held outside of items (the registry calls
+//       it at the end of a frame once its queues are empty).
+//
+//-----------------------------------------------------------------------------
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace Marvel {
+
+	class mvIdentifier
+	{
+
+	public:
+
+		mvIdentifier() = default;
+		explicit mvIdentifier(const std::string& name);
+		explicit mvIdentifier(const char* name);
+
+		static mvIdentifier Find(const std::string& name);
+
+		static void   Retain       (mvIdentifier identifier);
+		static void   Release      (mvIdentifier identifier);
+		static size_t Compact      (); // returns the number of entries released
+		static void   GetTableStats(size_t& entries, size_t& bytes);
+
+		const std::string& getString() const;
+		uint32_t           getId    () const { return m_id; }
+		bool               empty    () const { return m_id == 0u; }
+
+		bool operator==(const mvIdentifier& other) const { return m_id == other.m_id; }
+		bool operator!=(const mvIdentifier& other) const { return m_id != other.m_id; }
+		bool operator< (const mvIdentifier& other) const { return m_id < other.m_id; }
+
+	private:
+
+		uint32_t m_id = 0u;
+
+	};
+
+}
+
+namespace std {
+
+	template<>
+	struct hash<Marvel::mvIdentifier>
+	{
+		size_t operator()(const Marvel::mvIdentifier& identifier) const { return identifier.getId(); }
+	};
+
+}
@@ -3,6 +3,7 @@
 #include "mvProfiler.h"
 #include "mvPythonTranslator.h"
 #include "mvEvents.h"
+#include "mvCallbackRegistry.h"
 
 namespace Marvel {
 
@@ -14,32 +15,53 @@ namespace Marvel {
 	bool    mvInput::s_mouseDragging = false;
 	mvVec2  mvInput::s_mouseDragDelta = { 0.0f, 0.0f };
 
+	// input events are only worth routing when a callback will receive them
+	static bool IsRouted(PyObject* callback)
+	{
+#if defined(MV_DEBUG)
+		return true; // event listener shows all input
+#else
+		return callback != nullptr;
+#endif
+	}
+
 	void mvInput::CheckInputs()
 	{
 		MV_PROFILE_FUNCTION();
 
+		mvCallbackRegistry* registry = mvCallbackRegistry::GetCallbackRegistry();
+		ImGuiIO& io = ImGui::GetIO();
+
+		bool keyPress   = IsRouted(registry->getKeyPressCallback()) || IsRouted(registry->getAcceleratorCallback());
+		bool keyDown    = IsRouted(registry->getKeyDownCallback());
+		bool keyRelease = IsRouted(registry->getKeyReleaseCallback());
+
 		// route key events
-		for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().KeysDown); i++)
+		if (keyPress || keyDown || keyRelease)
 		{
-			// route key pressed event
-			if (ImGui::IsKeyPressed(i))
-				mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_KEY_PRESS, { CreateEventArgument("KEY", i) });
-
-			// route key down event
-			if (ImGui::GetIO().KeysDownDuration[i] >= 0.0f)
-				mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_KEY_DOWN,
-					{ CreateEventArgument("KEY", i), CreateEventArgument("DURATION", ImGui::GetIO().KeysDownDuration[i]) });
-
-			// route key released event
-			if (ImGui::IsKeyReleased(i))
-				mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_KEY_RELEASE, { CreateEventArgument("KEY", i) });
+			for (int i = 0; i < IM_ARRAYSIZE(io.KeysDown); i++)
+			{
+				// route key pressed event
+				if (keyPress && ImGui::IsKeyPressed(i))
+					mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_KEY_PRESS, { CreateEventArgument("KEY", i) });
+
+				// route key down event
+				if (keyDown && io.KeysDownDuration[i] >= 0.0f)
+					mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_KEY_DOWN,
+						{ CreateEventArgument("KEY", i), CreateEventArgument("DURATION", io.KeysDownDuration[i]) });
+
+				// route key released event
+				if (keyRelease && ImGui::IsKeyReleased(i))
+					mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_KEY_RELEASE, { CreateEventArgument("KEY", i) });
+			}
 		}
 
 		// route mouse wheel event
-		if (ImGui::GetIO().MouseWheel != 0.0f)
-			mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_WHEEL, { CreateEventArgument("DELTA", ImGui::GetIO().MouseWheel) });
+		if (io.MouseWheel != 0.0f && IsRouted(registry->getMouseWheelCallback()))
+			mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_WHEEL, { CreateEventArgument("DELTA", io.MouseWheel) });
 
-		// route mouse dragging event
+		// route mouse dragging event (drag state is kept for polling either way)
+		bool mouseDrag = IsRouted(registry->getMouseDragCallback());
 		for (int i = 0; i < 3; i++)
 		{
 			if (ImGui::IsMouseDragging(i, mvInput::getMouseDragThreshold()))
@@ -47,11 +69,12 @@ namespace Marvel {
 				// TODO: send delta
 				mvInput::setMouseDragging(true);
 				mvInput::setMouseDragDelta({ ImGui::GetMouseDragDelta().x, ImGui::GetMouseDragDelta().y });
-				mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_DRAG,
-					{ CreateEventArgument("BUTTON", i),
-					CreateEventArgument("X", ImGui::GetMouseDragDelta().x),
-					CreateEventArgument("Y", ImGui::GetMouseDragDelta().y)
-					});
+				if (mouseDrag)
+					mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_DRAG,
+						{ CreateEventArgument("BUTTON", i),
+						CreateEventArgument("X", ImGui::GetMouseDragDelta().x),
+						CreateEventArgument("Y", ImGui::GetMouseDragDelta().y)
+						});
 				ImGui::ResetMouseDragDelta(i);
 				break;
 			}
@@ -61,25 +84,33 @@ namespace Marvel {
 			mvInput::setMouseDragDelta({ 0.0f, 0.0f });
 		}
 
+		bool mouseClick    = IsRouted(registry->getMouseClickCallback());
+		bool mouseDown     = IsRouted(registry->getMouseDownCallback());
+		bool mouseDblClick = IsRouted(registry->getMouseDoubleClickCallback());
+		bool mouseRelease  = IsRouted(registry->getMouseReleaseCallback());
+
 		// route other mouse events (note mouse move callbacks are handled in mvWindowAppItem)
-		for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().MouseDown); i++)
+		if (mouseClick || mouseDown || mouseDblClick || mouseRelease)
 		{
-			// route mouse click event
-			if (ImGui::IsMouseClicked(i))
-				mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_CLICK, { CreateEventArgument("BUTTON", i) });
-
-			// route mouse down event
-			if (ImGui::GetIO().MouseDownDuration[i] >= 0.0f)
-				mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_DOWN,
-					{ CreateEventArgument("BUTTON", i), CreateEventArgument("DURATION",  ImGui::GetIO().MouseDownDuration[i]) });
-
-			// route mouse double clicked event
-			if (ImGui::IsMouseDoubleClicked(i))
-				mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_DBL_CLK, { CreateEventArgument("BUTTON", i) });
-
-			// route mouse released event
-			if (ImGui::IsMouseReleased(i))
-				mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_RELEASE, { CreateEventArgument("BUTTON", i) });
+			for (int i = 0; i < IM_ARRAYSIZE(io.MouseDown); i++)
+			{
+				// route mouse click event
+				if (mouseClick && ImGui::IsMouseClicked(i))
+					mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_CLICK, { CreateEventArgument("BUTTON", i) });
+
+				// route mouse down event
+				if (mouseDown && io.MouseDownDuration[i] >= 0.0f)
+					mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_DOWN,
+						{ CreateEventArgument("BUTTON", i), CreateEventArgument("DURATION", io.MouseDownDuration[i]) });
+
+				// route mouse double clicked event
+				if (mouseDblClick && ImGui::IsMouseDoubleClicked(i))
+					mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_DBL_CLK, { CreateEventArgument("BUTTON", i) });
+
+				// route mouse released event
+				if (mouseRelease && ImGui::IsMouseReleased(i))
+					mvEventBus::Publish(mvEVT_CATEGORY_INPUT, mvEVT_MOUSE_RELEASE, { CreateEventArgument("BUTTON", i) });
+			}
 		}
 	}
 
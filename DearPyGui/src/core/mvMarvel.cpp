@@ -9,6 +9,7 @@
 #include "mvPythonExceptions.h"
 #include <ImGuiFileDialog.h>
 #include <cstdlib>
+#include <unordered_map>
 
 // new includes
 #include "mvPlotInterface.h"
@@ -29,6 +30,16 @@
 //-----------------------------------------------------------------------------
 #define ADD_PYTHON_FUNCTION(Function) { #Function, (PyCFunction)Function, METH_VARARGS | METH_KEYWORDS, (*mvApp::GetApp()->getParsers())[#Function].getDocumentation() },
 
+// hot commands take their arguments as an array plus keyword names and look
+// their parser up once (the parser map is never freed); python 3.6 passes the
+// keyword names with plain METH_FASTCALL
+#if PY_VERSION_HEX >= 0x03070000
+#define MV_METH_FASTCALL (METH_FASTCALL | METH_KEYWORDS)
+#else
+#define MV_METH_FASTCALL METH_FASTCALL
+#endif
+#define ADD_PYTHON_FASTCALL(Function) { #Function, (PyCFunction)(void(*)(void))Function, MV_METH_FASTCALL, (*mvApp::GetApp()->getParsers())[#Function].getDocumentation() },
+
 namespace Marvel {
 
 	std::map<std::string, mvPythonParser>* BuildDearPyGuiInterface()
@@ -50,6 +61,17 @@ namespace Marvel {
 		AddBasicWidgets(parsers);
 		AddContainerWidgets(parsers);
 		AddAppCommands(parsers);
+
+		// queries don't change anything that needs to be drawn
+		for (auto& parser : *parsers)
+		{
+			const std::string& name = parser.first;
+			parser.second.setQuery(name.rfind("get_", 0) == 0 || name.rfind("is_", 0) == 0 || name.rfind("does_", 0) == 0);
+		}
+
+		// any other command may change what is drawn (power saving)
+		mvPythonParser::SetStateChangeCallback([]() { mvApp::RequestFrames(); });
+
 		return parsers;
 	}
 
@@ -495,6 +517,9 @@ namespace Marvel {
 			{ "mvTEX_RGBA_FLOAT", 1 },
 			{ "mvTEX_RGB_FLOAT", 2 },
 			{ "mvTEX_RGB_INT", 3 },
+			{ "mvTEX_RGBA_UINT8", 4 },
+			{ "mvTEX_RGB_UINT8", 5 },
+			{ "mvTEX_GRAY_UINT8", 6 },
 
 		};
 
@@ -503,13 +528,16 @@ namespace Marvel {
 
 	static PyMethodDef dearpyguimethods[]
 	{
-		ADD_PYTHON_FUNCTION(get_item_configuration)
-		ADD_PYTHON_FUNCTION(configure_item)
+		ADD_PYTHON_FASTCALL(get_item_configuration)
+		ADD_PYTHON_FASTCALL(configure_item)
 
 		// app interface
 		ADD_PYTHON_FUNCTION(enable_docking)
 		ADD_PYTHON_FUNCTION(add_texture)
 		ADD_PYTHON_FUNCTION(decrement_texture)
+		ADD_PYTHON_FUNCTION(update_texture)
+		ADD_PYTHON_FUNCTION(set_async_texture_loading)
+		ADD_PYTHON_FUNCTION(set_texture_atlas)
 		ADD_PYTHON_FUNCTION(add_character_remap)
 		ADD_PYTHON_FUNCTION(set_primary_window)
 		ADD_PYTHON_FUNCTION(set_accelerator_callback)
@@ -527,6 +555,7 @@ namespace Marvel {
 		ADD_PYTHON_FUNCTION(render_dearpygui_frame)
 		ADD_PYTHON_FUNCTION(cleanup_dearpygui)
 		ADD_PYTHON_FUNCTION(start_dearpygui)
+		ADD_PYTHON_FUNCTION(get_headless_draw_stats)
 		ADD_PYTHON_FUNCTION(get_global_font_scale)
 		ADD_PYTHON_FUNCTION(set_global_font_scale)
 		ADD_PYTHON_FUNCTION(select_directory_dialog)
@@ -539,7 +568,16 @@ namespace Marvel {
 		ADD_PYTHON_FUNCTION(open_file_dialog)
 		ADD_PYTHON_FUNCTION(set_exit_callback)
 		ADD_PYTHON_FUNCTION(set_vsync)
+		ADD_PYTHON_FUNCTION(set_power_saving)
 		ADD_PYTHON_FUNCTION(stop_dearpygui)
+		ADD_PYTHON_FUNCTION(start_profiling)
+		ADD_PYTHON_FUNCTION(stop_profiling)
+		ADD_PYTHON_FUNCTION(save_profile)
+		ADD_PYTHON_FUNCTION(set_frame_cost_sampling)
+		ADD_PYTHON_FUNCTION(get_frame_cost_breakdown)
+		ADD_PYTHON_FUNCTION(get_frame_stats)
+		ADD_PYTHON_FUNCTION(reset_frame_stats)
+		ADD_PYTHON_FUNCTION(get_memory_stats)
 		ADD_PYTHON_FUNCTION(is_dearpygui_running)
 		ADD_PYTHON_FUNCTION(set_main_window_title)
 		ADD_PYTHON_FUNCTION(set_main_window_pos)
@@ -558,22 +596,23 @@ namespace Marvel {
 
 		// app item interface
 		ADD_PYTHON_FUNCTION(move_item)
+		ADD_PYTHON_FUNCTION(add_items)
 		ADD_PYTHON_FUNCTION(get_managed_column_width)
 		ADD_PYTHON_FUNCTION(set_managed_column_width)
 		ADD_PYTHON_FUNCTION(get_item_type)
 		ADD_PYTHON_FUNCTION(set_item_callback)
-		ADD_PYTHON_FUNCTION(get_value)
-		ADD_PYTHON_FUNCTION(set_value)
+		ADD_PYTHON_FASTCALL(get_value)
+		ADD_PYTHON_FASTCALL(set_value)
 		ADD_PYTHON_FUNCTION(add_value)
 		ADD_PYTHON_FUNCTION(incref_value)
 		ADD_PYTHON_FUNCTION(decref_value)
-		ADD_PYTHON_FUNCTION(is_item_hovered)
+		ADD_PYTHON_FASTCALL(is_item_hovered)
 		ADD_PYTHON_FUNCTION(is_item_shown)
-		ADD_PYTHON_FUNCTION(is_item_active)
+		ADD_PYTHON_FASTCALL(is_item_active)
 		ADD_PYTHON_FUNCTION(is_item_focused)
 		ADD_PYTHON_FUNCTION(is_item_clicked)
 		ADD_PYTHON_FUNCTION(is_item_container)
-		ADD_PYTHON_FUNCTION(is_item_visible)
+		ADD_PYTHON_FASTCALL(is_item_visible)
 		ADD_PYTHON_FUNCTION(is_item_edited)
 		ADD_PYTHON_FUNCTION(is_item_activated)
 		ADD_PYTHON_FUNCTION(is_item_deactivated)
@@ -585,7 +624,7 @@ namespace Marvel {
 		ADD_PYTHON_FUNCTION(get_item_callback)
 		ADD_PYTHON_FUNCTION(get_item_parent)
 		ADD_PYTHON_FUNCTION(delete_item)
-		ADD_PYTHON_FUNCTION(does_item_exist)
+		ADD_PYTHON_FASTCALL(does_item_exist)
 		ADD_PYTHON_FUNCTION(move_item_down)
 		ADD_PYTHON_FUNCTION(move_item_up)
 		ADD_PYTHON_FUNCTION(get_windows)
@@ -671,17 +710,17 @@ namespace Marvel {
 		ADD_PYTHON_FUNCTION(set_mouse_move_callback)
 		ADD_PYTHON_FUNCTION(set_mouse_drag_callback)
 		ADD_PYTHON_FUNCTION(is_mouse_button_dragging)
-		ADD_PYTHON_FUNCTION(is_mouse_button_down)
+		ADD_PYTHON_FASTCALL(is_mouse_button_down)
 		ADD_PYTHON_FUNCTION(is_mouse_button_clicked)
 		ADD_PYTHON_FUNCTION(is_mouse_button_double_clicked)
 		ADD_PYTHON_FUNCTION(is_mouse_button_released)
 		ADD_PYTHON_FUNCTION(get_mouse_drag_delta)
 		ADD_PYTHON_FUNCTION(set_mouse_wheel_callback)
-		ADD_PYTHON_FUNCTION(get_mouse_pos)
+		ADD_PYTHON_FASTCALL(get_mouse_pos)
 		ADD_PYTHON_FUNCTION(get_plot_mouse_pos)
-		ADD_PYTHON_FUNCTION(is_key_pressed)
+		ADD_PYTHON_FASTCALL(is_key_pressed)
 		ADD_PYTHON_FUNCTION(is_key_released)
-		ADD_PYTHON_FUNCTION(is_key_down)
+		ADD_PYTHON_FASTCALL(is_key_down)
 		ADD_PYTHON_FUNCTION(set_mouse_click_callback)
 		ADD_PYTHON_FUNCTION(set_mouse_down_callback)
 		ADD_PYTHON_FUNCTION(set_mouse_double_click_callback)
@@ -843,6 +882,27 @@ namespace Marvel {
 		{NULL, NULL, 0, NULL}
 	};
 
+	PyObject* GetPythonCommand(const std::string& name)
+	{
+		static std::unordered_map<std::string, PyObject*> commands;
+
+		auto found = commands.find(name);
+		if (found != commands.end())
+			return found->second;
+
+		for (PyMethodDef* def = dearpyguimethods; def->ml_name; def++)
+		{
+			if (name == def->ml_name)
+			{
+				PyObject* command = PyCFunction_NewEx(def, nullptr, nullptr);
+				commands[name] = command;
+				return command;
+			}
+		}
+
+		return nullptr;
+	}
+
 	static PyModuleDef dearpyguiModule = {
 		PyModuleDef_HEAD_INIT, "core", NULL, -1, dearpyguimethods,
 		NULL, NULL, NULL, NULL
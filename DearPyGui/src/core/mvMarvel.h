@@ -21,5 +21,8 @@ namespace Marvel {
 
 	std::vector<std::pair<std::string, long>> GetModuleConstants();
 
+	// module command by name, borrowed reference (nullptr if unknown)
+	PyObject* GetPythonCommand(const std::string& name);
+
 	void start_dearpygui_error();
 }
@@ -0,0 +1,158 @@
+#include "mvMemory.h"
+#include <cstdlib>
+#include <imgui.h>
+#include "mvApp.h"
+#include "mvAppLog.h"
+#include "mvItemPool.h"
+#include "mvIdentifier.h"
+#include "mvTextureStorage.h"
+#include "mvValueStorage.h"
+
+namespace Marvel {
+
+	mvMemory::Counter mvMemory::s_counters[(int)mvMemoryCategory::Count];
+
+	// imgui's allocator functions are global and blocks must be freed by the
+	// allocator that made them, so they are installed during static
+	// initialization, before anything (the logger included) allocates
+	static const bool s_imguiAllocatorInstalled = []()
+	{
+		ImGui::SetAllocatorFunctions(mvMemory::ImGuiAlloc, mvMemory::ImGuiFree, nullptr);
+		return true;
+	}();
+
+	// imgui frees without a size, keep it in front of the block
+	static constexpr size_t ImGuiHeaderSize = alignof(std::max_align_t);
+
+	void mvMemory::UpdatePeak(Counter& counter)
+	{
+		int64_t bytes = counter.tracked.load(std::memory_order_relaxed) + counter.measured.load(std::memory_order_relaxed);
+		int64_t peak = counter.peak.load(std::memory_order_relaxed);
+		while (bytes > peak && !counter.peak.compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {}
+	}
+
+	void* mvMemory::Allocate(mvMemoryCategory category, size_t size)
+	{
+		void* ptr = ::operator new(size);
+		Record(category, size);
+		return ptr;
+	}
+
+	void mvMemory::Deallocate(mvMemoryCategory category, void* ptr, size_t size)
+	{
+		if (ptr == nullptr)
+			return;
+
+		Release(category, size);
+		::operator delete(ptr);
+	}
+
+	void mvMemory::Record(mvMemoryCategory category, size_t size)
+	{
+		Counter& counter = s_counters[(int)category];
+		counter.tracked.fetch_add((int64_t)size, std::memory_order_relaxed);
+		counter.allocations.fetch_add(1, std::memory_order_relaxed);
+		counter.total.fetch_add(1, std::memory_order_relaxed);
+		UpdatePeak(counter);
+	}
+
+	void mvMemory::Release(mvMemoryCategory category, size_t size)
+	{
+		Counter& counter = s_counters[(int)category];
+		counter.tracked.fetch_sub((int64_t)size, std::memory_order_relaxed);
+		counter.allocations.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	void mvMemory::SetMeasured(mvMemoryCategory category, int64_t bytes)
+	{
+		Counter& counter = s_counters[(int)category];
+		counter.measured.store(bytes, std::memory_order_relaxed);
+		UpdatePeak(counter);
+	}
+
+	void mvMemory::Refresh()
+	{
+		mvApp* app = mvApp::GetApp();
+
+		int64_t cpu = 0;
+		int64_t gpu = 0;
+		app->getTextureStorage().getMemoryUsage(cpu, gpu);
+		SetMeasured(mvMemoryCategory::Textures, cpu);
+		SetMeasured(mvMemoryCategory::TextureGPU, gpu);
+
+		// the logger's buffers are imgui allocations, move them out of its total
+		int64_t logger = (int64_t)mvAppLog::GetBufferBytes();
+		SetMeasured(mvMemoryCategory::Logger, logger);
+		SetMeasured(mvMemoryCategory::ImGui, -logger);
+
+		SetMeasured(mvMemoryCategory::ValueStorage, (int64_t)app->getValueStorage().getPayloadBytes());
+
+		// pooled slots not holding an item
+		SetMeasured(mvMemoryCategory::Items, (int64_t)mvItemPool::GetIdleBytes());
+
+		size_t names = 0;
+		size_t nameBytes = 0;
+		mvIdentifier::GetTableStats(names, nameBytes);
+		SetMeasured(mvMemoryCategory::Names, (int64_t)nameBytes);
+	}
+
+	void mvMemory::ResetPeaks()
+	{
+		for (auto& counter : s_counters)
+		{
+			counter.peak.store(0, std::memory_order_relaxed);
+			UpdatePeak(counter);
+		}
+	}
+
+	mvMemoryStats mvMemory::GetStats(mvMemoryCategory category)
+	{
+		const Counter& counter = s_counters[(int)category];
+
+		mvMemoryStats stats;
+		stats.bytes = counter.tracked.load(std::memory_order_relaxed) + counter.measured.load(std::memory_order_relaxed);
+		stats.peak = counter.peak.load(std::memory_order_relaxed);
+		stats.allocations = counter.allocations.load(std::memory_order_relaxed);
+		stats.totalAllocations = counter.total.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	const char* mvMemory::GetCategoryName(mvMemoryCategory category)
+	{
+		switch (category)
+		{
+		case mvMemoryCategory::ImGui:        return "imgui";
+		case mvMemoryCategory::Items:        return "items";
+		case mvMemoryCategory::ValueStorage: return "value_storage";
+		case mvMemoryCategory::PlotData:     return "plot_data";
+		case mvMemoryCategory::DrawLists:    return "draw_lists";
+		case mvMemoryCategory::Textures:     return "textures";
+		case mvMemoryCategory::TextureGPU:   return "textures_gpu";
+		case mvMemoryCategory::Logger:       return "logger";
+		case mvMemoryCategory::Names:        return "names";
+		default:                             return "unknown";
+		}
+	}
+
+	void* mvMemory::ImGuiAlloc(size_t size, void* user_data)
+	{
+		char* block = (char*)malloc(size + ImGuiHeaderSize);
+		if (block == nullptr)
+			return nullptr;
+
+		*(size_t*)block = size;
+		Record(mvMemoryCategory::ImGui, size);
+		return block + ImGuiHeaderSize;
+	}
+
+	void mvMemory::ImGuiFree(void* ptr, void* user_data)
+	{
+		if (ptr == nullptr)
+			return;
+
+		char* block = (char*)ptr - ImGuiHeaderSize;
+		Release(mvMemoryCategory::ImGui, *(size_t*)block);
+		free(block);
+	}
+
+}
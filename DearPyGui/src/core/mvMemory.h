@@ -0,0 +1,131 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// mvMemory
+//
+//     - Keeps per subsystem byte counts so memory growth can be attributed.
+//       Allocations are counted where they happen through imgui's allocator
+//       functions, class level operator new/delete (draw commands, series),
+//       mvItemPool (items) and mvTrackedAllocator for our own containers.
+//       Counting is a couple of relaxed atomic adds per allocation.
+//
+//     - Memory that isn't allocated through a hook (texture pixels on the
+//       GPU, logger buffers, value storage payloads, idle item pool slots,
+//       the interned item name table)
+//       is measured on demand by Refresh and added to the category's
+//       tracked bytes.
+//
+//-----------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <string>
+#include <unordered_map>
+
+namespace Marvel {
+
+	enum class mvMemoryCategory
+	{
+		ImGui, Items, ValueStorage, PlotData, DrawLists, Textures, TextureGPU, Logger, Names, Count
+	};
+
+	struct mvMemoryStats
+	{
+		int64_t  bytes = 0;
+		int64_t  peak = 0;
+		int64_t  allocations = 0; // live tracked allocations
+		uint64_t totalAllocations = 0;
+	};
+
+	//-----------------------------------------------------------------------------
+	// mvMemory
+	//-----------------------------------------------------------------------------
+	class mvMemory
+	{
+
+	public:
+
+		static void*         Allocate   (mvMemoryCategory category, size_t size);
+		static void          Deallocate (mvMemoryCategory category, void* ptr, size_t size);
+
+		// counts memory allocated elsewhere
+		static void          Record     (mvMemoryCategory category, size_t size);
+		static void          Release    (mvMemoryCategory category, size_t size);
+
+		// sets the measured (not allocation hooked) part of a category
+		static void          SetMeasured(mvMemoryCategory category, int64_t bytes);
+
+		// measures textures, logger buffers, value payloads and idle
+		// item pool slots (main thread or GIL held)
+		static void          Refresh    ();
+		static void          ResetPeaks ();
+
+		static mvMemoryStats GetStats       (mvMemoryCategory category);
+		static const char*   GetCategoryName(mvMemoryCategory category);
+
+		// installed as imgui's allocator functions
+		static void*         ImGuiAlloc(size_t size, void* user_data);
+		static void          ImGuiFree (void* ptr, void* user_data);
+
+	private:
+
+		struct Counter
+		{
+			std::atomic<int64_t>  tracked     = 0;
+			std::atomic<int64_t>  measured    = 0;
+			std::atomic<int64_t>  peak        = 0;
+			std::atomic<int64_t>  allocations = 0;
+			std::atomic<uint64_t> total       = 0;
+		};
+
+		static void UpdatePeak(Counter& counter);
+
+		static Counter s_counters[(int)mvMemoryCategory::Count];
+
+	};
+
+	//-----------------------------------------------------------------------------
+	// mvTrackedAllocator
+	//-----------------------------------------------------------------------------
+	template<typename T, mvMemoryCategory C>
+	class mvTrackedAllocator
+	{
+
+	public:
+
+		using value_type = T;
+
+		template<typename U>
+		struct rebind { using other = mvTrackedAllocator<U, C>; };
+
+		mvTrackedAllocator() = default;
+
+		template<typename U>
+		mvTrackedAllocator(const mvTrackedAllocator<U, C>&) {}
+
+		T*   allocate  (size_t n) { return static_cast<T*>(mvMemory::Allocate(C, n * sizeof(T))); }
+		void deallocate(T* ptr, size_t n) { mvMemory::Deallocate(C, ptr, n * sizeof(T)); }
+
+		template<typename U>
+		bool operator==(const mvTrackedAllocator<U, C>&) const { return true; }
+
+		template<typename U>
+		bool operator!=(const mvTrackedAllocator<U, C>&) const { return false; }
+
+	};
+
+	template<typename K, typename V, mvMemoryCategory C>
+	using mvTrackedMap = std::unordered_map<K, V, std::hash<K>, std::equal_to<K>, mvTrackedAllocator<std::pair<const K, V>, C>>;
+
+}
+
+//-----------------------------------------------------------------------------
+// Counts a class hierarchy's heap allocations (sized delete sees the
+// most derived size through the virtual destructor)
+//-----------------------------------------------------------------------------
+#define MV_TRACK_ALLOCATIONS(category) \
+	static void* operator new(size_t size) { return Marvel::mvMemory::Allocate(category, size); } \
+	static void operator delete(void* ptr, size_t size) { Marvel::mvMemory::Deallocate(category, ptr, size); }
@@ -0,0 +1,174 @@
+#include "mvPolygonFill.h"
+
+namespace Marvel {
+
+	static float Cross(const ImVec2& a, const ImVec2& b, const ImVec2& c)
+	{
+		return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+	}
+
+	static bool InTriangle(const ImVec2& p, const ImVec2& a, const ImVec2& b, const ImVec2& c)
+	{
+		// triangle is counter clockwise here
+		return Cross(a, b, p) >= 0.0f && Cross(b, c, p) >= 0.0f && Cross(c, a, p) >= 0.0f;
+	}
+
+	void TriangulatePolygon(const std::vector<ImVec2>& points, std::vector<ImVec2>& triangles)
+	{
+		triangles.clear();
+
+		int n = (int)points.size();
+		if (n < 3)
+			return;
+
+		// work on a counter clockwise index list
+		float area = 0.0f;
+		for (int i = 0, j = n - 1; i < n; j = i++)
+			area += points[j].x * points[i].y - points[i].x * points[j].y;
+
+		std::vector<int> indices(n);
+		for (int i = 0; i < n; i++)
+			indices[i] = area > 0.0f ? i : n - 1 - i;
+
+		triangles.reserve((size_t)(n - 2) * 3u);
+
+		int guard = 2 * n;
+		int i = 0;
+		while (n > 3 && guard-- > 0)
+		{
+			int prev = indices[(i + n - 1) % n];
+			int curr = indices[i % n];
+			int next = indices[(i + 1) % n];
+			const ImVec2& a = points[prev];
+			const ImVec2& b = points[curr];
+			const ImVec2& c = points[next];
+
+			float turn = Cross(a, b, c);
+
+			// duplicate or collinear vertices add no area
+			if (turn == 0.0f)
+			{
+				indices.erase(indices.begin() + (i % n));
+				n--;
+				guard = 2 * n;
+				i = i % n;
+				continue;
+			}
+
+			bool ear = turn > 0.0f;
+			for (int k = 0; ear && k < n; k++)
+			{
+				int other = indices[k];
+				if (other != prev && other != curr && other != next && InTriangle(points[other], a, b, c))
+					ear = false;
+			}
+
+			if (ear)
+			{
+				triangles.push_back(a);
+				triangles.push_back(b);
+				triangles.push_back(c);
+				indices.erase(indices.begin() + (i % n));
+				n--;
+				guard = 2 * n;
+				i = i % n;
+			}
+			else
+				i = (i + 1) % n;
+		}
+
+		// self intersecting or degenerate input, fan the rest
+		for (int k = 1; k + 1 < n; k++)
+		{
+			triangles.push_back(points[indices[0]]);
+			triangles.push_back(points[indices[k]]);
+			triangles.push_back(points[indices[k + 1]]);
+		}
+	}
+
+	bool TriangulateMonotoneArea(const std::vector<ImVec2>& points, std::vector<ImVec2>& triangles)
+	{
+		triangles.clear();
+
+		size_t n = points.size();
+		if (n < 3)
+			return true;
+
+		bool increasing = true;
+		bool decreasing = true;
+		for (size_t i = 1; i < n; i++)
+		{
+			if (points[i].x < points[i - 1].x) increasing = false;
+			if (points[i].x > points[i - 1].x) decreasing = false;
+		}
+
+		if (!increasing && !decreasing)
+			return false;
+
+		const ImVec2& first = points.front();
+		const ImVec2& last = points.back();
+		if (first.x == last.x)
+			return true;
+
+		// the closing edge, evaluated at x
+		float slope = (last.y - first.y) / (last.x - first.x);
+		auto chord = [&](float x) { return ImVec2(x, first.y + (x - first.x) * slope); };
+
+		triangles.reserve((n - 1) * 6u);
+
+		for (size_t i = 0; i + 1 < n; i++)
+		{
+			const ImVec2& a = points[i];
+			const ImVec2& b = points[i + 1];
+			if (a.x == b.x)
+				continue;
+
+			ImVec2 ca = chord(a.x);
+			ImVec2 cb = chord(b.x);
+			float da = a.y - ca.y;
+			float db = b.y - cb.y;
+
+			if (da * db >= 0.0f)
+			{
+				triangles.push_back(a); triangles.push_back(b); triangles.push_back(cb);
+				triangles.push_back(a); triangles.push_back(cb); triangles.push_back(ca);
+			}
+
+			// curve crosses the closing edge inside this segment
+			else
+			{
+				float t = da / (da - db);
+				ImVec2 m(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t);
+				triangles.push_back(a); triangles.push_back(m); triangles.push_back(ca);
+				triangles.push_back(m); triangles.push_back(b); triangles.push_back(cb);
+			}
+		}
+
+		return true;
+	}
+
+	void AddTrianglesFilled(ImDrawList* drawlist, const std::vector<ImVec2>& triangles, ImU32 color, const ImVec2& offset)
+	{
+		// chunked so each reservation stays within 16 bit indices
+		constexpr size_t chunk = 3u * 10000u;
+		ImVec2 uv = ImGui::GetFontTexUvWhitePixel();
+
+		for (size_t start = 0; start < triangles.size(); start += chunk)
+		{
+			size_t count = triangles.size() - start < chunk ? triangles.size() - start : chunk;
+			count -= count % 3u;
+			if (count == 0u)
+				break;
+
+			drawlist->PrimReserve((int)count, (int)count);
+			ImDrawIdx base = (ImDrawIdx)drawlist->_VtxCurrentIdx;
+			for (size_t i = 0; i < count; i++)
+			{
+				const ImVec2& p = triangles[start + i];
+				drawlist->PrimWriteVtx(ImVec2(p.x + offset.x, p.y + offset.y), uv, color);
+				drawlist->PrimWriteIdx((ImDrawIdx)(base + i));
+			}
+		}
+	}
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// mvPolygonFill
+//
+//     - Triangulation helpers used to fill polygons with a handful of
+//       triangles instead of scanning every pixel row.
+//
+//     - Triangles are stored as consecutive vertex triples so results can
+//       be cached and translated/transformed without reindexing.
+//     
+//-----------------------------------------------------------------------------
+
+#include <vector>
+#include <imgui.h>
+
+namespace Marvel {
+
+	// ear clipping for simple polygons (either winding)
+	void TriangulatePolygon(const std::vector<ImVec2>& points, std::vector<ImVec2>& triangles);
+
+	// area between a curve sorted by x and the edge closing it, matching the
+	// even-odd fill of the closed polygon. Returns false if x isn't sorted.
+	bool TriangulateMonotoneArea(const std::vector<ImVec2>& points, std::vector<ImVec2>& triangles);
+
+	void AddTrianglesFilled(ImDrawList* drawlist, const std::vector<ImVec2>& triangles, ImU32 color, const ImVec2& offset = ImVec2(0.0f, 0.0f));
+
+}
@@ -1,13 +1,48 @@
 #include "mvProfiler.h"
+#include <fstream>
+#include <cstdio>
 
 namespace Marvel {
 
+	// hands the thread's buffer back when the thread exits, so
+	// recreated thread pools don't add a buffer per thread
+	struct mvProfileThreadBufferOwner
+	{
+		mvProfileThreadBuffer* buffer = nullptr;
+
+		~mvProfileThreadBufferOwner()
+		{
+			if (buffer)
+				mvInstrumentor::Get().releaseThreadBuffer(buffer);
+		}
+	};
+
+	static thread_local mvProfileThreadBufferOwner t_owner;
+	static thread_local int                        t_depth = 0;
+
+	static void WriteJsonString(std::ofstream& out, const char* value)
+	{
+		out << '"';
+		for (const char* c = value; *c; c++)
+		{
+			if (*c == '"' || *c == '\\')
+				out << '\\' << *c;
+			else if ((unsigned char)*c < 0x20)
+				out << ' ';
+			else
+				out << *c;
+		}
+		out << '"';
+	}
+
 	//-----------------------------------------------------------------------------
 	// mvInstrumentor
 	//-----------------------------------------------------------------------------
-	void mvInstrumentor::BeginSession(const std::string& name)
+	void mvInstrumentor::BeginSession(const std::string& name, int eventsPerThread)
 	{
-		if (m_CurrentSession) 
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		if (m_CurrentSession)
 		{
 			// If there is already a current session, then close it before beginning new one.
 			// Subsequent profiling output meant for the original session will end up in the
@@ -17,18 +52,181 @@ namespace Marvel {
 			InternalEndSession();
 		}
 
+		m_CurrentSession = new mvInstrumentationSession{ name, std::chrono::steady_clock::now() };
+		m_sessionName = name;
+		m_sessionStart = std::chrono::duration_cast<std::chrono::nanoseconds>(m_CurrentSession->Start.time_since_epoch()).count();
+		m_eventsPerThread = eventsPerThread > 0 ? eventsPerThread : DefaultEventsPerThread;
+		m_results.clear();
+
+		// buffers reset themselves on their next write once they see the new generation
+		m_generation.fetch_add(1, std::memory_order_release);
+		m_recording = true;
 	}
 
 	void mvInstrumentor::EndSession()
 	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
 		InternalEndSession();
 	}
 
-	void mvInstrumentor::WriteProfile(const mvProfileResult& result)
+	mvProfileThreadBuffer* mvInstrumentor::getThreadBuffer()
+	{
+		if (t_owner.buffer)
+			return t_owner.buffer;
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		// a reused buffer keeps the exited thread's events for the session
+		// and its tid, the threads never ran at the same time
+		if (!m_freeBuffers.empty())
+		{
+			t_owner.buffer = m_freeBuffers.back();
+			m_freeBuffers.pop_back();
+		}
+		else
+		{
+			m_buffers.push_back(std::make_unique<mvProfileThreadBuffer>());
+			t_owner.buffer = m_buffers.back().get();
+			t_owner.buffer->index = (int)m_buffers.size();
+		}
+
+		t_owner.buffer->name = "Thread " + std::to_string(t_owner.buffer->index);
+		return t_owner.buffer;
+	}
+
+	void mvInstrumentor::releaseThreadBuffer(mvProfileThreadBuffer* buffer)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_freeBuffers.push_back(buffer);
+	}
+
+	void mvInstrumentor::WriteProfile(const char* name, std::chrono::time_point<std::chrono::steady_clock> start,
+		std::chrono::time_point<std::chrono::steady_clock> end, int depth)
+	{
+		mvProfileThreadBuffer* buffer = getThreadBuffer();
+
+		int generation = m_generation.load(std::memory_order_acquire);
+		if (buffer->generation.load(std::memory_order_relaxed) != generation)
+		{
+			// only the owning thread touches the event storage, the exporter
+			// skips this buffer until the new generation is published
+			buffer->events.resize(m_eventsPerThread);
+			buffer->count.store(0, std::memory_order_relaxed);
+			buffer->dropped.store(0, std::memory_order_relaxed);
+			buffer->frameStart = 0;
+			buffer->generation.store(generation, std::memory_order_release);
+		}
+
+		// scope started before the session did
+		int64_t startTime = std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch()).count() - m_sessionStart;
+		if (startTime < 0)
+			return;
+
+		int index = buffer->count.load(std::memory_order_relaxed);
+		if (index >= (int)buffer->events.size())
+		{
+			buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		mvProfileEvent& event = buffer->events[index];
+		event.name = name;
+		event.start = startTime;
+		event.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+		event.depth = depth;
+
+		buffer->count.store(index + 1, std::memory_order_release);
+	}
+
+	void mvInstrumentor::EndFrame()
+	{
+		if (!isRecording())
+			return;
+
+		mvProfileThreadBuffer* buffer = getThreadBuffer();
+		if (buffer->generation.load(std::memory_order_relaxed) != m_generation.load(std::memory_order_acquire))
+			return;
+
+		m_results.clear();
+
+		int count = buffer->count.load(std::memory_order_relaxed);
+		for (int i = buffer->frameStart; i < count; i++)
+		{
+			const mvProfileEvent& event = buffer->events[i];
+			m_results[event.name] += std::chrono::microseconds(event.duration / 1000);
+		}
+
+		buffer->frameStart = count;
+	}
+
+	void mvInstrumentor::SetThreadName(const std::string& name)
+	{
+		mvProfileThreadBuffer* buffer = getThreadBuffer();
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		buffer->name = name;
+	}
+
+	int mvInstrumentor::getDroppedEvents()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		int generation = m_generation.load(std::memory_order_acquire);
+		int dropped = 0;
+		for (const auto& buffer : m_buffers)
+		{
+			if (buffer->generation.load(std::memory_order_acquire) == generation)
+				dropped += buffer->dropped.load(std::memory_order_relaxed);
+		}
+
+		return dropped;
+	}
+
+	bool mvInstrumentor::WriteChromeTrace(const std::string& file)
 	{
+		std::ofstream out(file);
+		if (!out.is_open())
+			return false;
+
+		// holding the lock keeps a new session from resetting buffers mid export
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		int generation = m_generation.load(std::memory_order_acquire);
+		int dropped = 0;
+		char number[64];
+
+		out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":";
+		WriteJsonString(out, m_sessionName.c_str());
+		out << "}}";
+
+		for (const auto& buffer : m_buffers)
+		{
+			if (buffer->generation.load(std::memory_order_acquire) != generation)
+				continue;
 
-		m_results[result.Name] = result.ElapsedTime;
+			int count = buffer->count.load(std::memory_order_acquire);
+			dropped += buffer->dropped.load(std::memory_order_relaxed);
 
+			out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->index << ",\"args\":{\"name\":";
+			WriteJsonString(out, buffer->name.c_str());
+			out << "}}";
+
+			for (int i = 0; i < count; i++)
+			{
+				const mvProfileEvent& event = buffer->events[i];
+
+				out << ",\n{\"name\":";
+				WriteJsonString(out, event.name);
+				snprintf(number, sizeof(number), ",\"ts\":%.3f,\"dur\":%.3f", event.start / 1000.0, event.duration / 1000.0);
+				out << ",\"cat\":\"dpg\",\"ph\":\"X\"" << number << ",\"pid\":1,\"tid\":" << buffer->index
+					<< ",\"args\":{\"depth\":" << event.depth << "}}";
+			}
+		}
+
+		out << "\n],\"otherData\":{\"droppedEvents\":" << dropped << "}}\n";
+
+		return out.good();
 	}
 
 	mvInstrumentor& mvInstrumentor::Get()
@@ -38,7 +236,8 @@ namespace Marvel {
 	}
 
 	void mvInstrumentor::InternalEndSession() {
-		if (m_CurrentSession) 
+		m_recording = false;
+		if (m_CurrentSession)
 		{
 			delete m_CurrentSession;
 			m_CurrentSession = nullptr;
@@ -51,6 +250,13 @@ namespace Marvel {
 	mvInstrumentationTimer::mvInstrumentationTimer(const char* name)
 		: m_Name(name), m_Stopped(false)
 	{
+		if (!mvInstrumentor::Get().isRecording())
+		{
+			m_Stopped = true;
+			return;
+		}
+
+		m_Depth = t_depth++;
 		m_StartTimepoint = std::chrono::steady_clock::now();
 	}
 
@@ -62,13 +268,16 @@ namespace Marvel {
 
 	void mvInstrumentationTimer::Stop()
 	{
+		if (m_Stopped)
+			return;
+
 		auto endTimepoint = std::chrono::steady_clock::now();
-		auto highResStart = FloatingPointMicroseconds{ m_StartTimepoint.time_since_epoch() };
-		auto elapsedTime = std::chrono::time_point_cast<std::chrono::microseconds>(endTimepoint).time_since_epoch() - std::chrono::time_point_cast<std::chrono::microseconds>(m_StartTimepoint).time_since_epoch();
+		t_depth--;
 
-		mvInstrumentor::Get().WriteProfile({ m_Name, highResStart, elapsedTime });
+		if (mvInstrumentor::Get().isRecording())
+			mvInstrumentor::Get().WriteProfile(m_Name, m_StartTimepoint, endTimepoint, m_Depth);
 
 		m_Stopped = true;
 	}
 
-}
\ No newline at end of file
+}
@@ -1,8 +1,29 @@
 #pragma once
 
+//-----------------------------------------------------------------------------
+// mvProfiler
+//
+//     - Always compiled, recording is switched on at runtime with
+//       BeginSession/EndSession. While no session is running a scope
+//       costs a single relaxed atomic load.
+//
+//     - Every thread records into its own fixed size event buffer so
+//       the hot path never takes a lock. A full buffer drops events
+//       (counted) rather than overwriting ones the exporter may read.
+//
+//     - WriteChromeTrace exports the session as Chrome trace JSON
+//       (chrome://tracing, Perfetto).
+//
+//-----------------------------------------------------------------------------
+
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <string>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace Marvel {
 
@@ -11,16 +32,29 @@ namespace Marvel {
 	//-----------------------------------------------------------------------------
 	// Useful structs
 	//-----------------------------------------------------------------------------
-	struct mvProfileResult
+	struct mvProfileEvent
 	{
-		std::string Name;
-		FloatingPointMicroseconds Start;
-		std::chrono::microseconds ElapsedTime;
+		const char* name;  // must outlive the session (string literals)
+		int64_t     start; // ns since session start
+		int64_t     duration; // ns
+		int         depth;
+	};
+
+	struct mvProfileThreadBuffer
+	{
+		std::vector<mvProfileEvent> events;
+		std::atomic_int             count = 0;
+		std::atomic_int             dropped = 0;
+		std::atomic_int             generation = -1;
+		int                         frameStart = 0;
+		int                         index = 0;
+		std::string                 name;
 	};
 
 	struct mvInstrumentationSession
 	{
 		std::string Name;
+		std::chrono::time_point<std::chrono::steady_clock> Start;
 	};
 
 	//-----------------------------------------------------------------------------
@@ -29,19 +63,37 @@ namespace Marvel {
 	class mvInstrumentor
 	{
 
+	public:
+
+		static constexpr int DefaultEventsPerThread = 1 << 16;
+
 	public:
 
 		mvInstrumentor() : m_CurrentSession(nullptr) {}
 
 		// Call to begin recording profile data (must call end session at a later time)
-		void BeginSession(const std::string& name);
+		void BeginSession(const std::string& name, int eventsPerThread = DefaultEventsPerThread);
 
-		// Call to end recording profile data
+		// Call to end recording profile data (recorded events are kept for export)
 		void EndSession();
 
-		// Used to write data to the profiling file
-		void WriteProfile(const mvProfileResult& result);
+		// Used by mvInstrumentationTimer to record a finished scope
+		void WriteProfile(const char* name, std::chrono::time_point<std::chrono::steady_clock> start,
+			std::chrono::time_point<std::chrono::steady_clock> end, int depth);
+
+		// Writes the last session as Chrome trace JSON, returns false if the file can't be opened
+		bool WriteChromeTrace(const std::string& file);
+
+		// Names the calling thread in exported traces
+		void SetThreadName(const std::string& name);
 
+		// Totals the calling thread's scopes since the last call (called once per frame)
+		void EndFrame();
+
+		bool isRecording() const { return m_recording.load(std::memory_order_relaxed); }
+		int  getDroppedEvents();
+
+		// per frame totals (µs) of the thread calling EndFrame
 		const std::map<std::string, std::chrono::microseconds>& getResults() const { return m_results; }
 
 		static mvInstrumentor& Get();
@@ -52,10 +104,23 @@ namespace Marvel {
 		// calling InternalEndSession()
 		void InternalEndSession();
 
+		mvProfileThreadBuffer* getThreadBuffer    ();
+		void                   releaseThreadBuffer(mvProfileThreadBuffer* buffer); // owning thread exited
+
+		friend struct mvProfileThreadBufferOwner;
+
 	private:
 
-		mvInstrumentationSession* m_CurrentSession;
-		std::map<std::string, std::chrono::microseconds> m_results;
+		mvInstrumentationSession*                           m_CurrentSession;
+		std::atomic_bool                                    m_recording = false;
+		std::atomic_int                                     m_generation = 0;
+		int                                                 m_eventsPerThread = DefaultEventsPerThread;
+		std::atomic<int64_t>                                m_sessionStart = 0; // steady clock ns
+		std::string                                         m_sessionName = "DearPyGui";
+		std::mutex                                          m_Mutex;
+		std::vector<std::unique_ptr<mvProfileThreadBuffer>> m_buffers;
+		std::vector<mvProfileThreadBuffer*>                 m_freeBuffers; // left by exited threads, reused by new ones
+		std::map<std::string, std::chrono::microseconds>    m_results;
 
 	};
 
@@ -77,22 +142,23 @@ namespace Marvel {
 
 		const char*                                        m_Name;
 		bool                                               m_Stopped;
+		int                                                m_Depth = 0;
 		std::chrono::time_point<std::chrono::steady_clock> m_StartTimepoint;
 
 	};
 
 }
 
-#if defined(MV_PROFILE) && defined(MV_DEBUG)
+#if defined(_MSC_VER)
+	#define MV_PROFILE_FUNCSIG __FUNCSIG__
+#else
+	#define MV_PROFILE_FUNCSIG __PRETTY_FUNCTION__
+#endif
+
+#define MV_PROFILE_CONCAT_IMPL(a, b) a##b
+#define MV_PROFILE_CONCAT(a, b) MV_PROFILE_CONCAT_IMPL(a, b)
 
 #define MV_PROFILE_BEGIN_SESSION(name) ::Marvel::mvInstrumentor::Get().BeginSession(name)
 #define MV_PROFILE_END_SESSION() ::Marvel::mvInstrumentor::Get().EndSession()
-#define MV_PROFILE_SCOPE(name) ::Marvel::mvInstrumentationTimer timer##__LINE__(name);
-#define MV_PROFILE_FUNCTION() MV_PROFILE_SCOPE(__FUNCSIG__)
-
-#else
-	#define MV_PROFILE_BEGIN_SESSION(name)
-	#define MV_PROFILE_END_SESSION()
-	#define MV_PROFILE_SCOPE(name)
-	#define MV_PROFILE_FUNCTION()
-#endif
\ No newline at end of file
+#define MV_PROFILE_SCOPE(name) ::Marvel::mvInstrumentationTimer MV_PROFILE_CONCAT(timer, __LINE__)(name);
+#define MV_PROFILE_FUNCTION() MV_PROFILE_SCOPE(MV_PROFILE_FUNCSIG)
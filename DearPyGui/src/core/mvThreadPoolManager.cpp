@@ -66,6 +66,20 @@ namespace Marvel {
 		return false;
 	}
 
+	mvThreadPool* mvThreadPoolManager::getThreadPool()
+	{
+		// check if threadpool is valid, if not, create it
+		if (m_tpool == nullptr)
+		{
+			m_tpool = new mvThreadPool(m_threadPoolHighPerformance ? 0 : m_threads);
+			m_poolStart = clock_::now();
+			m_threadPool = true;
+			mvAppLog::Log("Threadpool created");
+		}
+
+		return m_tpool;
+	}
+
 	bool mvThreadPoolManager::onPostRender(mvEvent& event)
 	{
 		Py_BEGIN_ALLOW_THREADS
@@ -73,18 +87,7 @@ namespace Marvel {
 
 			// async callbacks
 			if (mvCallbackRegistry::GetCallbackRegistry()->hasAsyncCallbacks())
-			{
-				// check if threadpool is valid, if not, create it
-				if (m_tpool == nullptr)
-				{
-					m_tpool = new mvThreadPool(m_threadPoolHighPerformance ? 0 : m_threads);
-					m_poolStart = clock_::now();
-					m_threadPool = true;
-					mvAppLog::Log("Threadpool created");
-				}
-
-				mvCallbackRegistry::GetCallbackRegistry()->runAsyncCallbacks(m_tpool);
-			}
+				mvCallbackRegistry::GetCallbackRegistry()->runAsyncCallbacks(getThreadPool());
 
 		// update timer if thread pool exists
 		if (m_tpool != nullptr)
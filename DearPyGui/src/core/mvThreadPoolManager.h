@@ -31,6 +31,9 @@ namespace Marvel {
 		bool onPreRender(mvEvent& event);
 		bool onPostRender(mvEvent& event);
 
+		// creates the pool if it doesn't exist yet
+		mvThreadPool*            getThreadPool();
+
 		void                     setThreadPoolTimeout(double time) { m_threadPoolTimeout = time; }
 		void                     setThreadCount(unsigned count) { m_threads = count; }
 		void                     activateThreadPool() { m_threadPool = true; }
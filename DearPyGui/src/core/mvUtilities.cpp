@@ -0,0 +1,28 @@
+#include "mvUtilities.h"
+
+namespace Marvel {
+
+	std::vector<unsigned char> ExpandToRGBA(const unsigned char* data, unsigned width, unsigned height, mvTextureFormat format)
+	{
+		size_t pixels = (size_t)width * (size_t)height;
+		std::vector<unsigned char> rgba(pixels * 4u);
+		for (size_t i = 0; i < pixels; i++)
+		{
+			if (format == mvTextureFormat::GRAY_UINT8)
+			{
+				rgba[i * 4u] = data[i];
+				rgba[i * 4u + 1u] = data[i];
+				rgba[i * 4u + 2u] = data[i];
+			}
+			else
+			{
+				rgba[i * 4u] = data[i * 3u];
+				rgba[i * 4u + 1u] = data[i * 3u + 1u];
+				rgba[i * 4u + 2u] = data[i * 3u + 2u];
+			}
+			rgba[i * 4u + 3u] = 255u;
+		}
+		return rgba;
+	}
+
+}
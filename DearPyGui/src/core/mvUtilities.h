@@ -5,6 +5,8 @@
 //
 //     - This file contains typically platform specific functions. May need
 //       to rename to a more appropriate name.
+//
+//     - Helpers shared by the backends are in core/mvUtilities.cpp.
 //     
 //-----------------------------------------------------------------------------
 
@@ -16,7 +18,22 @@ namespace Marvel {
 
 	bool        UnloadTexture       (const std::string& filename);
 	bool        LoadTextureFromArray(const char* name, float* data, unsigned width, unsigned height, mvTexture& storage, mvTextureFormat format);
+	bool        UpdateTextureFromArray(mvTexture& storage, float* data, unsigned x, unsigned y, unsigned width, unsigned height); // RGBA sub-rectangle
 	bool        LoadTextureFromFile (const char* filename, mvTexture& storage);
+	bool        LoadTextureFromPixels(const char* name, unsigned char* data, unsigned width, unsigned height, mvTexture& storage); // RGBA
+	bool        LoadTextureFromBytes(const char* name, unsigned char* data, unsigned width, unsigned height, mvTexture& storage, mvTextureFormat format); // *_UINT8 formats
+	bool        UpdateTextureFromBytes(mvTexture& storage, unsigned char* data, unsigned x, unsigned y, unsigned width, unsigned height, mvTextureFormat format);
 	void        FreeTexture         (mvTexture& storage);
+	int         GetMaxTextureSize   (); // largest width or height the renderer accepts
+
+#if defined(__linux__)
+	void        FreeUploadBuffers   (); // before the GL context is destroyed
+#endif
+
+	// for backends that only sample 8 bit RGBA (still a quarter of the float size)
+	std::vector<unsigned char> ExpandToRGBA(const unsigned char* data, unsigned width, unsigned height, mvTextureFormat format); // RGB_UINT8 or GRAY_UINT8
+
+	// headless runs have no renderer, textures only record their size
+	bool        LoadHeadlessTexture (unsigned width, unsigned height, mvTexture& storage, mvTextureFormat format);
 
 }
\ No newline at end of file
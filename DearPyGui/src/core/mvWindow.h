@@ -29,7 +29,7 @@ namespace Marvel {
 		static mvWindow* CreatemvWindow(unsigned width, unsigned height, bool error = false);
 
 		mvWindow(unsigned width, unsigned height, bool error = false);
-		virtual ~mvWindow() = default;
+		virtual ~mvWindow() { mvEventBus::UnSubscribe(this); }
 
 		bool onEvent (mvEvent& event) override;
 		bool onRender(mvEvent& event);
@@ -46,6 +46,7 @@ namespace Marvel {
 		virtual void postrender () {}
 		virtual void cleanup    () {}
 		virtual void setWindowText(const std::string& name) {}
+		virtual void wake         () {} // interrupts waiting for events (any thread)
 		
 		void stop      () { m_running = false; }
 		void setupFonts();
@@ -1,4 +1,5 @@
 #include "core/mvUtilities.h"
+#include "mvApp.h"
 #include "mvAppleWindow.h"
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -19,6 +20,9 @@ namespace Marvel {
     bool LoadTextureFromArray(const char* name, float* data, unsigned width, unsigned height, mvTexture& storage, mvTextureFormat format)
     {
 
+        if (mvApp::IsAppHeadless())
+            return LoadHeadlessTexture(width, height, storage, format);
+
         MTLTextureDescriptor *textureDescriptor = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatRGBA32Float width:width height:height mipmapped:NO];
 
 
@@ -26,6 +30,8 @@ namespace Marvel {
         textureDescriptor.storageMode = MTLStorageModeManaged;
 
         id <MTLTexture> texture = [mvAppleWindow::GetDevice() newTextureWithDescriptor:textureDescriptor];
+        if (texture == nil)
+            return false;
         [texture replaceRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0 withBytes:data bytesPerRow:width * 4];
 
         g_textures.push_back({name, texture});
@@ -33,10 +39,56 @@ namespace Marvel {
         storage.texture = (__bridge void*)g_textures.back().second;
         storage.width = width;
         storage.height = height;
+        storage.ubyte = false;
+        storage.channels = 4u;
+
+        return true;
+    }
+
+    bool UpdateTextureFromArray(mvTexture& storage, float* data, unsigned x, unsigned y, unsigned width, unsigned height)
+    {
+        if (mvApp::IsAppHeadless())
+            return storage.texture != nullptr;
+
+        if (storage.texture == nullptr || x + width > (unsigned)storage.width || y + height > (unsigned)storage.height)
+            return false;
+
+        id <MTLTexture> texture = (__bridge id <MTLTexture>)storage.texture;
+        [texture replaceRegion:MTLRegionMake2D(x, y, width, height) mipmapLevel:0 withBytes:data bytesPerRow:width * 4 * sizeof(float)];
+
+        return true;
+    }
+
+    bool UpdateTextureFromBytes(mvTexture& storage, unsigned char* data, unsigned x, unsigned y, unsigned width, unsigned height, mvTextureFormat format)
+    {
+        if (mvApp::IsAppHeadless())
+            return storage.texture != nullptr;
+
+        if (storage.texture == nullptr || x + width > (unsigned)storage.width || y + height > (unsigned)storage.height)
+            return false;
+
+        std::vector<unsigned char> rgba;
+        if (format != mvTextureFormat::RGBA_UINT8)
+        {
+            rgba = ExpandToRGBA(data, width, height, format);
+            data = rgba.data();
+        }
+
+        id <MTLTexture> texture = (__bridge id <MTLTexture>)storage.texture;
+        [texture replaceRegion:MTLRegionMake2D(x, y, width, height) mipmapLevel:0 withBytes:data bytesPerRow:width * 4];
 
         return true;
     }
 
+    bool LoadTextureFromBytes(const char* name, unsigned char* data, unsigned width, unsigned height, mvTexture& storage, mvTextureFormat format)
+    {
+        if (format == mvTextureFormat::RGBA_UINT8)
+            return LoadTextureFromPixels(name, data, width, height, storage);
+
+        std::vector<unsigned char> rgba = ExpandToRGBA(data, width, height, format);
+        return LoadTextureFromPixels(name, rgba.data(), width, height, storage);
+    }
+
     bool LoadTextureFromFile(const char* filename, mvTexture& storage)
     {
         int width, height;
@@ -45,6 +97,17 @@ namespace Marvel {
         if (image_data == nullptr)
             return false;
 
+        bool loaded = LoadTextureFromPixels(filename, image_data, width, height, storage);
+        stbi_image_free(image_data);
+
+        return loaded;
+    }
+
+    bool LoadTextureFromPixels(const char* name, unsigned char* data, unsigned width, unsigned height, mvTexture& storage)
+    {
+        if (mvApp::IsAppHeadless())
+            return LoadHeadlessTexture(width, height, storage, mvTextureFormat::RGBA_UINT8);
+
         MTLTextureDescriptor *textureDescriptor = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatRGBA8Unorm
                                                                                                      width:width
                                                                                                     height:height
@@ -53,13 +116,17 @@ namespace Marvel {
         textureDescriptor.storageMode = MTLStorageModeManaged;
 
         id <MTLTexture> texture = [mvAppleWindow::GetDevice() newTextureWithDescriptor:textureDescriptor];
-        [texture replaceRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0 withBytes:image_data bytesPerRow:width * 4];
+        if (texture == nil)
+            return false;
+        [texture replaceRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0 withBytes:data bytesPerRow:width * 4];
 
-        g_textures.push_back({filename, texture});
+        g_textures.push_back({name, texture});
 
         storage.texture = (__bridge void*)g_textures.back().second;
         storage.width = width;
         storage.height = height;
+        storage.ubyte = true;
+        storage.channels = 4u;
 
         return true;
     }
@@ -84,4 +151,10 @@ namespace Marvel {
 
     }
 
+    int GetMaxTextureSize()
+    {
+        // every GPU running metal on macOS supports 16384
+        return 16384;
+    }
+
 }
@@ -1,5 +1,6 @@
 #include "mvAppleWindow.h"
 #include "Registries/mvDataStorage.h"
+#include "mvFrameStats.h"
 #include <implot.h>
 
 #define GLFW_INCLUDE_NONE
@@ -131,6 +132,7 @@ namespace Marvel {
         if(glfwGetWindowAttrib(m_window, GLFW_ICONIFIED))
         {
             glfwWaitEvents();
+            mvFrameStats::MarkIdle();
             return;
         }
 
@@ -184,6 +186,7 @@ namespace Marvel {
                 m_app->render();
 
             // Rendering
+            mvFrameStatsScope phase(mvFramePhase::Present);
             ImGui::Render();
             ImGui_ImplMetal_RenderDrawData(ImGui::GetDrawData(), commandBuffer, m_renderEncoder);
 
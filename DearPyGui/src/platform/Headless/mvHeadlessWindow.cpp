@@ -0,0 +1,105 @@
+#include "platform/Headless/mvHeadlessWindow.h"
+#include "mvApp.h"
+#include "mvUtilities.h"
+#include "implot.h"
+#include "imgui.h"
+
+namespace Marvel {
+
+	mvHeadlessDrawStats mvHeadlessWindow::s_stats;
+
+	bool LoadHeadlessTexture(unsigned width, unsigned height, mvTexture& storage, mvTextureFormat format)
+	{
+		storage.texture = (void*)(intptr_t)1; // never sampled
+		storage.width = width;
+		storage.height = height;
+		storage.ubyte = IsByteTextureFormat(format);
+		storage.channels = format == mvTextureFormat::GRAY_UINT8 ? 1u : 4u;
+		return true;
+	}
+
+	mvHeadlessWindow::mvHeadlessWindow(unsigned width, unsigned height, int frames)
+		: mvWindow(width, height, false), m_frames(frames)
+	{
+		s_stats = {};
+
+		mvEventBus::Publish(mvEVT_CATEGORY_VIEWPORT, mvEVT_VIEWPORT_RESIZE, {
+			CreateEventArgument("actual_width", (int)width),
+			CreateEventArgument("actual_height", (int)height),
+			CreateEventArgument("client_width", (int)width),
+			CreateEventArgument("client_height", (int)height)
+			});
+
+		IMGUI_CHECKVERSION();
+		ImGui::CreateContext();
+		ImPlot::CreateContext();
+		ImGuiIO& io = ImGui::GetIO();
+		io.ConfigWindowsMoveFromTitleBarOnly = true;
+		io.IniFilename = nullptr;
+		io.DisplaySize = ImVec2((float)width, (float)height);
+		setupFonts();
+
+		if (mvApp::GetApp()->m_docking)
+			io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+
+		if (mvApp::GetApp()->m_dockingShiftOnly)
+			io.ConfigDockingWithShift = true;
+
+		ImGui::StyleColorsDark();
+
+		// the font atlas still has to be built, it's just never uploaded
+		unsigned char* pixels = nullptr;
+		int atlasWidth = 0;
+		int atlasHeight = 0;
+		io.Fonts->GetTexDataAsRGBA32(&pixels, &atlasWidth, &atlasHeight);
+		io.Fonts->TexID = (ImTextureID)(intptr_t)1;
+	}
+
+	mvHeadlessWindow::~mvHeadlessWindow()
+	{
+		ImPlot::DestroyContext();
+		ImGui::DestroyContext();
+		mvApp::s_started = false;
+	}
+
+	void mvHeadlessWindow::renderFrame()
+	{
+		prerender();
+		m_app->render();
+		postrender();
+	}
+
+	void mvHeadlessWindow::run()
+	{
+		setup();
+		for (int frame = 0; m_running && (m_frames <= 0 || frame < m_frames); frame++)
+			renderFrame();
+	}
+
+	void mvHeadlessWindow::prerender()
+	{
+		// fixed time step keeps runs comparable
+		ImGuiIO& io = ImGui::GetIO();
+		io.DisplaySize = ImVec2((float)m_width, (float)m_height);
+		io.DeltaTime = 1.0f / 60.0f;
+
+		ImGui::NewFrame();
+	}
+
+	void mvHeadlessWindow::postrender()
+	{
+		ImGui::Render();
+
+		ImDrawData* drawData = ImGui::GetDrawData();
+		s_stats.frames++;
+		if (drawData == nullptr)
+			return;
+
+		s_stats.vertices += drawData->TotalVtxCount;
+		s_stats.indices += drawData->TotalIdxCount;
+		s_stats.lists += drawData->CmdListsCount;
+		for (int i = 0; i < drawData->CmdListsCount; i++)
+			s_stats.commands += drawData->CmdLists[i]->CmdBuffer.Size;
+	}
+
+}
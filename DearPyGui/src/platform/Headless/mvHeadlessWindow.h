@@ -0,0 +1,56 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// mvHeadlessWindow
+//
+//     - Null renderer viewport. Runs the full frame (ImGui/ImPlot, items,
+//       callbacks) at a fixed display size without a window, graphics
+//       context or GPU and discards the draw data after counting it.
+//
+//     - Used for benchmarks and tests on machines without a display.
+//     
+//-----------------------------------------------------------------------------
+
+#include "core/mvWindow.h"
+
+namespace Marvel {
+
+	//-----------------------------------------------------------------------------
+	// mvHeadlessDrawStats
+	//     - draw data discarded by the null renderer
+	//-----------------------------------------------------------------------------
+	struct mvHeadlessDrawStats
+	{
+		long long frames   = 0;
+		long long vertices = 0;
+		long long indices  = 0;
+		long long lists    = 0; // draw lists
+		long long commands = 0; // draw commands
+	};
+
+	class mvHeadlessWindow : public mvWindow
+	{
+
+	public:
+
+		// frames = 0 renders until stopped
+		mvHeadlessWindow(unsigned width, unsigned height, int frames);
+		~mvHeadlessWindow() override;
+
+		void prerender  () override;
+		void postrender () override;
+		void renderFrame() override;
+		void run        () override;
+
+		// totals of the current (or last) headless run
+		static const mvHeadlessDrawStats& GetDrawStats() { return s_stats; }
+
+	private:
+
+		int m_frames = 0;
+
+		static mvHeadlessDrawStats s_stats;
+
+	};
+
+}
@@ -1,6 +1,9 @@
 #include "platform/Linux/mvLinuxWindow.h"
 #include "mvApp.h"
 #include "Registries/mvDataStorage.h"
+#include "mvProfiler.h"
+#include "mvFrameStats.h"
+#include "mvUtilities.h"
 #include <GL/gl3w.h>
 #include <GLFW/glfw3.h>
 #include "implot.h"
@@ -100,6 +103,7 @@ namespace Marvel {
     mvLinuxWindow::~mvLinuxWindow()
 	{
         // Cleanup
+        FreeUploadBuffers();
         ImGui_ImplOpenGL3_Shutdown();
         ImGui_ImplGlfw_Shutdown();
         ImGui::DestroyContext();
@@ -114,8 +118,14 @@ namespace Marvel {
         glfwSetWindowTitle(m_window, name.c_str());
     }
 
+    void mvLinuxWindow::wake()
+    {
+        glfwPostEmptyEvent();
+    }
+
     void mvLinuxWindow::renderFrame()
     {
+        MV_PROFILE_FUNCTION();
 
         prerender();
 
@@ -147,11 +157,16 @@ namespace Marvel {
 
     void mvLinuxWindow::prerender()
     {
+        MV_PROFILE_FUNCTION();
+
         m_running = !glfwWindowShouldClose(m_window);
 
         if(glfwGetWindowAttrib(m_window, GLFW_ICONIFIED))
         {
+            Py_BEGIN_ALLOW_THREADS
             glfwWaitEvents();
+            Py_END_ALLOW_THREADS
+            mvFrameStats::MarkIdle();
             return;
         }
 
@@ -160,7 +175,25 @@ namespace Marvel {
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
-        glfwPollEvents();
+        if (m_app->getPowerSaving() && !m_app->isFrameRequested())
+        {
+            // sleep until input arrives, a frame is requested or max idle passes
+            double timeout = m_app->getMaxIdleTime();
+            double start = glfwGetTime();
+
+            // other threads need the GIL to request frames and wake us
+            Py_BEGIN_ALLOW_THREADS
+            glfwWaitEventsTimeout(timeout);
+            Py_END_ALLOW_THREADS
+
+            mvFrameStats::MarkIdle();
+
+            // input needs a few frames to settle (hover, popups, layout)
+            if (glfwGetTime() - start < timeout)
+                mvApp::RequestFrames();
+        }
+        else
+            glfwPollEvents();
 
         // Start the Dear ImGui frame
         ImGui_ImplOpenGL3_NewFrame();
@@ -171,6 +204,9 @@ namespace Marvel {
 
     void mvLinuxWindow::postrender()
     {
+        MV_PROFILE_FUNCTION();
+        mvFrameStatsScope phase(mvFramePhase::Present);
+
         // Rendering
         ImGui::Render();
         int display_w, display_h;
@@ -194,6 +230,7 @@ namespace Marvel {
     void mvLinuxWindow::cleanup()
     {
         // Cleanup
+        FreeUploadBuffers();
         ImGui_ImplOpenGL3_Shutdown();
         ImGui_ImplGlfw_Shutdown();
         ImPlot::DestroyContext();
@@ -1,16 +1,77 @@
 #include "core/mvUtilities.h"
+#include "mvApp.h"
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 #include <string>
 #include <vector>
+#include <cstring>
 #include <GL/gl3w.h>
 #include <GLFW/glfw3.h>
 
 namespace Marvel {
 
+    //-----------------------------------------------------------------------------
+    // pixel buffer ring used to stream texture updates so glTexSubImage2D
+    // doesn't have to wait on textures still being drawn
+    //-----------------------------------------------------------------------------
+    static constexpr int s_pboCount = 3;
+    static GLuint        s_pbos[s_pboCount] = {};
+    static size_t        s_pboSizes[s_pboCount] = {};
+    static int           s_pboIndex = 0;
+
+    static void UploadRegion(mvTexture& storage, const void* data, size_t size, unsigned x, unsigned y, unsigned width, unsigned height, GLenum format, GLenum type)
+    {
+        if (s_pbos[0] == 0)
+            glGenBuffers(s_pboCount, s_pbos);
+
+        s_pboIndex = (s_pboIndex + 1) % s_pboCount;
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, s_pbos[s_pboIndex]);
+
+        if (s_pboSizes[s_pboIndex] < size)
+        {
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+            s_pboSizes[s_pboIndex] = size;
+        }
+
+        void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        if (mapped)
+        {
+            memcpy(mapped, data, size);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        }
+        else
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        glBindTexture(GL_TEXTURE_2D, (GLuint)(size_t)storage.texture);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        // source is the bound pixel buffer when mapping succeeded
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, format, type, mapped ? nullptr : data);
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    void FreeUploadBuffers()
+    {
+        if (s_pbos[0] == 0)
+            return;
+
+        glDeleteBuffers(s_pboCount, s_pbos);
+        for (int i = 0; i < s_pboCount; i++)
+        {
+            s_pbos[i] = 0;
+            s_pboSizes[i] = 0;
+        }
+    }
+
     bool LoadTextureFromArray(const char* name, float* data, unsigned width, unsigned height, mvTexture& storage, mvTextureFormat format)
     {
 
+        if (mvApp::IsAppHeadless())
+            return LoadHeadlessTexture(width, height, storage, format);
+
         // Create a OpenGL texture identifier
         GLuint image_texture;
         glGenTextures(1, &image_texture);
@@ -27,20 +88,29 @@ namespace Marvel {
         storage.texture = reinterpret_cast<void *>(image_texture);
         storage.width = width;
         storage.height = height;
+        storage.ubyte = false;
+        storage.channels = 4u;
 
         return true;
     }
 
-    // Simple helper function to load an image into a DX11 texture with common settings
-    bool LoadTextureFromFile(const char* filename, mvTexture& storage)
+    bool LoadTextureFromBytes(const char* name, unsigned char* data, unsigned width, unsigned height, mvTexture& storage, mvTextureFormat format)
     {
 
-        // Load from file
-        int image_width = 0;
-        int image_height = 0;
-        unsigned char* image_data = stbi_load(filename, &image_width, &image_height, nullptr, 4);
-        if (image_data == nullptr)
-            return false;
+        if (mvApp::IsAppHeadless())
+            return LoadHeadlessTexture(width, height, storage, format);
+
+        GLint internalFormat = GL_RGBA8;
+        GLenum sourceFormat = GL_RGBA;
+
+        if (format == mvTextureFormat::RGB_UINT8)
+            sourceFormat = GL_RGB;
+
+        else if (format == mvTextureFormat::GRAY_UINT8)
+        {
+            internalFormat = GL_R8;
+            sourceFormat = GL_RED;
+        }
 
         // Create a OpenGL texture identifier
         GLuint image_texture;
@@ -48,21 +118,86 @@ namespace Marvel {
         glBindTexture(GL_TEXTURE_2D, image_texture);
 
         // Setup filtering parameters for display
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-        // Upload pixels into texture
+        GLint filter = storage.nearest ? GL_NEAREST : GL_LINEAR;
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+
+        // single channel textures are sampled as opaque gray
+        if (format == mvTextureFormat::GRAY_UINT8)
+        {
+            GLint swizzle[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+            glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+        }
+
+        // Upload pixels into texture (rows of RGB/gray data aren't 4 byte aligned)
         glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image_width, image_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image_data);
-        stbi_image_free(image_data);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, sourceFormat, GL_UNSIGNED_BYTE, data);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
         storage.texture = reinterpret_cast<void *>(image_texture);
-        storage.width = image_width;
-        storage.height = image_height;
+        storage.width = width;
+        storage.height = height;
+        storage.ubyte = true;
+        storage.channels = format == mvTextureFormat::GRAY_UINT8 ? 1u : 4u;
 
         return true;
     }
 
+    bool UpdateTextureFromArray(mvTexture& storage, float* data, unsigned x, unsigned y, unsigned width, unsigned height)
+    {
+        if (mvApp::IsAppHeadless())
+            return storage.texture != nullptr;
+
+        if (storage.texture == nullptr || x + width > (unsigned)storage.width || y + height > (unsigned)storage.height)
+            return false;
+
+        UploadRegion(storage, data, (size_t)width * (size_t)height * 4u * sizeof(float), x, y, width, height, GL_RGBA, GL_FLOAT);
+
+        return true;
+    }
+
+    bool UpdateTextureFromBytes(mvTexture& storage, unsigned char* data, unsigned x, unsigned y, unsigned width, unsigned height, mvTextureFormat format)
+    {
+        if (mvApp::IsAppHeadless())
+            return storage.texture != nullptr;
+
+        if (storage.texture == nullptr || x + width > (unsigned)storage.width || y + height > (unsigned)storage.height)
+            return false;
+
+        GLenum sourceFormat = GL_RGBA;
+        if (format == mvTextureFormat::RGB_UINT8)
+            sourceFormat = GL_RGB;
+        else if (format == mvTextureFormat::GRAY_UINT8)
+            sourceFormat = GL_RED;
+
+        UploadRegion(storage, data, (size_t)width * (size_t)height * GetTextureFormatSize(format), x, y, width, height, sourceFormat, GL_UNSIGNED_BYTE);
+
+        return true;
+    }
+
+    // Simple helper function to load an image into a DX11 texture with common settings
+    bool LoadTextureFromFile(const char* filename, mvTexture& storage)
+    {
+
+        // Load from file
+        int image_width = 0;
+        int image_height = 0;
+        unsigned char* image_data = stbi_load(filename, &image_width, &image_height, nullptr, 4);
+        if (image_data == nullptr)
+            return false;
+
+        LoadTextureFromPixels(filename, image_data, image_width, image_height, storage);
+        stbi_image_free(image_data);
+
+        return true;
+    }
+
+    bool LoadTextureFromPixels(const char* name, unsigned char* data, unsigned width, unsigned height, mvTexture& storage)
+    {
+        return LoadTextureFromBytes(name, data, width, height, storage, mvTextureFormat::RGBA_UINT8);
+    }
+
     bool UnloadTexture(const std::string& filename)
 	{
 		// TODO : decide if cleanup is necessary
@@ -71,8 +206,23 @@ namespace Marvel {
 
     void FreeTexture(mvTexture& storage)
     {
+        if (mvApp::IsAppHeadless())
+            return;
+
         auto out_srv = (GLuint)(size_t)storage.texture;
         glDeleteTextures(1, &out_srv);
     }
 
+    int GetMaxTextureSize()
+    {
+        // GL 3 guarantees at least 1024
+        static GLint maxSize = 0;
+        if (mvApp::IsAppHeadless())
+            return 16384;
+
+        if (maxSize == 0)
+            glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+        return maxSize > 0 ? maxSize : 1024;
+    }
+
 }
@@ -1,4 +1,5 @@
 #include "mvUtilities.h"
+#include "mvApp.h"
 #include "mvWindowsWindow.h"
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -21,6 +22,9 @@ namespace Marvel {
     bool LoadTextureFromArray(const char* name, float* data, unsigned width, unsigned height, mvTexture& storage, mvTextureFormat format)
     {
 
+        if (mvApp::IsAppHeadless())
+            return LoadHeadlessTexture(width, height, storage, format);
+
         //auto out_srv = static_cast<ID3D11ShaderResourceView**>(storage.texture);
         ID3D11ShaderResourceView* out_srv = nullptr;
 
@@ -42,7 +46,8 @@ namespace Marvel {
         subResource.pSysMem = data;
         subResource.SysMemPitch = desc.Width * 4 * 4;
         subResource.SysMemSlicePitch = 0;
-        mvWindowsWindow::getDevice()->CreateTexture2D(&desc, &subResource, &pTexture);
+        if (FAILED(mvWindowsWindow::getDevice()->CreateTexture2D(&desc, &subResource, &pTexture)) || pTexture == nullptr)
+            return false;
 
         // Create texture view
                 // Create texture view
@@ -58,17 +63,88 @@ namespace Marvel {
         storage.texture = out_srv;
         storage.width = width;
         storage.height = height;
+        storage.ubyte = false;
+        storage.channels = 4u;
+
+        return true;
+    }
+
+    bool UpdateTextureFromArray(mvTexture& storage, float* data, unsigned x, unsigned y, unsigned width, unsigned height)
+    {
+        if (mvApp::IsAppHeadless())
+            return storage.texture != nullptr;
+
+        if (storage.texture == nullptr || x + width > (unsigned)storage.width || y + height > (unsigned)storage.height)
+            return false;
+
+        ID3D11ShaderResourceView* srv = static_cast<ID3D11ShaderResourceView*>(storage.texture);
+        ID3D11Resource* resource = nullptr;
+        srv->GetResource(&resource);
+        if (resource == nullptr)
+            return false;
+
+        D3D11_BOX box;
+        box.left = x;
+        box.top = y;
+        box.front = 0;
+        box.right = x + width;
+        box.bottom = y + height;
+        box.back = 1;
+
+        mvWindowsWindow::getDeviceContext()->UpdateSubresource(resource, 0, &box, data, width * 4 * 4, 0);
+        resource->Release();
 
         return true;
     }
 
+    bool UpdateTextureFromBytes(mvTexture& storage, unsigned char* data, unsigned x, unsigned y, unsigned width, unsigned height, mvTextureFormat format)
+    {
+        if (mvApp::IsAppHeadless())
+            return storage.texture != nullptr;
+
+        if (storage.texture == nullptr || x + width > (unsigned)storage.width || y + height > (unsigned)storage.height)
+            return false;
+
+        std::vector<unsigned char> rgba;
+        if (format != mvTextureFormat::RGBA_UINT8)
+        {
+            rgba = ExpandToRGBA(data, width, height, format);
+            data = rgba.data();
+        }
+
+        ID3D11ShaderResourceView* srv = static_cast<ID3D11ShaderResourceView*>(storage.texture);
+        ID3D11Resource* resource = nullptr;
+        srv->GetResource(&resource);
+        if (resource == nullptr)
+            return false;
+
+        D3D11_BOX box;
+        box.left = x;
+        box.top = y;
+        box.front = 0;
+        box.right = x + width;
+        box.bottom = y + height;
+        box.back = 1;
+
+        mvWindowsWindow::getDeviceContext()->UpdateSubresource(resource, 0, &box, data, width * 4, 0);
+        resource->Release();
+
+        return true;
+    }
+
+    bool LoadTextureFromBytes(const char* name, unsigned char* data, unsigned width, unsigned height, mvTexture& storage, mvTextureFormat format)
+    {
+        if (format == mvTextureFormat::RGBA_UINT8)
+            return LoadTextureFromPixels(name, data, width, height, storage);
+
+        std::vector<unsigned char> rgba = ExpandToRGBA(data, width, height, format);
+        return LoadTextureFromPixels(name, rgba.data(), width, height, storage);
+    }
+
     // Simple helper function to load an image into a DX11 texture with common settings
     bool LoadTextureFromFile(const char* filename, mvTexture& storage)
     {
 
-        //auto out_srv = static_cast<ID3D11ShaderResourceView**>(storage.texture);
-        ID3D11ShaderResourceView* out_srv = nullptr;
-
         // Load from disk into a raw RGBA buffer
         int image_width = 0;
         int image_height = 0;
@@ -76,11 +152,26 @@ namespace Marvel {
         if (image_data == NULL)
             return false;
 
+        bool loaded = LoadTextureFromPixels(filename, image_data, image_width, image_height, storage);
+        stbi_image_free(image_data);
+
+        return loaded;
+    }
+
+    bool LoadTextureFromPixels(const char* name, unsigned char* data, unsigned width, unsigned height, mvTexture& storage)
+    {
+
+        if (mvApp::IsAppHeadless())
+            return LoadHeadlessTexture(width, height, storage, mvTextureFormat::RGBA_UINT8);
+
+        //auto out_srv = static_cast<ID3D11ShaderResourceView**>(storage.texture);
+        ID3D11ShaderResourceView* out_srv = nullptr;
+
         // Create texture
         D3D11_TEXTURE2D_DESC desc;
         ZeroMemory(&desc, sizeof(desc));
-        desc.Width = image_width;
-        desc.Height = image_height;
+        desc.Width = width;
+        desc.Height = height;
         desc.MipLevels = 1;
         desc.ArraySize = 1;
         desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
@@ -91,10 +182,11 @@ namespace Marvel {
 
         ID3D11Texture2D* pTexture = NULL;
         D3D11_SUBRESOURCE_DATA subResource;
-        subResource.pSysMem = image_data;
+        subResource.pSysMem = data;
         subResource.SysMemPitch = desc.Width * 4;
         subResource.SysMemSlicePitch = 0;
-        mvWindowsWindow::getDevice()->CreateTexture2D(&desc, &subResource, &pTexture);
+        if (FAILED(mvWindowsWindow::getDevice()->CreateTexture2D(&desc, &subResource, &pTexture)) || pTexture == nullptr)
+            return false;
 
         // Create texture view
         D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
@@ -107,9 +199,10 @@ namespace Marvel {
         pTexture->Release();
 
         storage.texture = out_srv;
-        storage.width = image_width;
-        storage.height = image_height;
-        stbi_image_free(image_data);
+        storage.width = width;
+        storage.height = height;
+        storage.ubyte = true;
+        storage.channels = 4u;
 
         return true;
     }
@@ -122,9 +215,29 @@ namespace Marvel {
 
     void FreeTexture(mvTexture& storage)
     {
+        if (mvApp::IsAppHeadless())
+            return;
+
         ID3D11ShaderResourceView* out_srv = static_cast<ID3D11ShaderResourceView*>(storage.texture);
-        out_srv->Release();
+        if (out_srv)
+            out_srv->Release();
         out_srv = nullptr;
     }
 
+    int GetMaxTextureSize()
+    {
+        if (mvApp::IsAppHeadless())
+            return D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION;
+
+        switch (mvWindowsWindow::getDevice()->GetFeatureLevel())
+        {
+        case D3D_FEATURE_LEVEL_9_1:
+        case D3D_FEATURE_LEVEL_9_2:  return D3D_FL9_1_REQ_TEXTURE2D_U_OR_V_DIMENSION;
+        case D3D_FEATURE_LEVEL_9_3:  return D3D_FL9_3_REQ_TEXTURE2D_U_OR_V_DIMENSION;
+        case D3D_FEATURE_LEVEL_10_0:
+        case D3D_FEATURE_LEVEL_10_1: return D3D10_REQ_TEXTURE2D_U_OR_V_DIMENSION;
+        default:                     return D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION;
+        }
+    }
+
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "mvApp.h"
 #include "implot.h"
 #include "mvDataStorage.h"
+#include "mvFrameStats.h"
 #include <cstdlib>
 #include <ctime>
 
@@ -155,6 +156,7 @@ namespace Marvel {
 
 	void mvWindowsWindow::postrender()
 	{
+		mvFrameStatsScope phase(mvFramePhase::Present);
 
 		ImVec4 clear_color = m_clearColor;
 
@@ -171,6 +173,7 @@ namespace Marvel {
 		if (s_pSwapChain->Present(mvApp::GetApp()->getVSync() ? 1 : 0, presentFlags) == DXGI_STATUS_OCCLUDED) {
 			presentFlags = DXGI_PRESENT_TEST;
 			Sleep(20);
+			mvFrameStats::MarkIdle();
 		}
 		else {
 			presentFlags = 0;
@@ -0,0 +1,59 @@
+from dearpygui.core import *
+from dearpygui.simple import *
+import time
+import sys
+
+########################################################################################################################
+# Command Call Benchmark
+#
+#   Measures calls/second for the commands applications call most often.
+#   The benchmarks run from the start callback so every command sees a
+#   running app, then the results are printed and the app stops.
+#
+#   usage: python benchmark_commands.py [calls per command]
+########################################################################################################################
+
+calls = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+
+benchmarks = [
+    ("get_value",              lambda: get_value("float")),
+    ("set_value",              lambda: set_value("float", 1.0)),
+    ("configure_item",         lambda: configure_item("float", width=200)),
+    ("get_item_configuration", lambda: get_item_configuration("float")),
+    ("does_item_exist",        lambda: does_item_exist("float")),
+    ("is_item_hovered",        lambda: is_item_hovered("float")),
+    ("is_item_active",         lambda: is_item_active("float")),
+    ("is_item_visible",        lambda: is_item_visible("float")),
+    ("is_item_clicked",        lambda: is_item_clicked("float")),
+    ("get_item_type",          lambda: get_item_type("float")),
+    ("get_item_children",      lambda: get_item_children("Benchmark")),
+    ("get_item_parent",        lambda: get_item_parent("float")),
+    ("get_item_rect_size",     lambda: get_item_rect_size("float")),
+    ("is_key_down",            lambda: is_key_down(mvKey_Shift)),
+    ("is_key_pressed",         lambda: is_key_pressed(mvKey_Shift)),
+    ("is_mouse_button_down",   lambda: is_mouse_button_down(mvMouseButton_Left)),
+    ("get_mouse_pos",          lambda: get_mouse_pos(local=False)),
+    ("get_delta_time",         lambda: get_delta_time()),
+    ("get_total_time",         lambda: get_total_time()),
+    ("get_data",               lambda: get_data("data")),
+]
+
+def run_benchmarks(sender, data):
+
+    print(f"{'command':<24}{'calls/s':>14}{'us/call':>10}")
+    for name, command in benchmarks:
+        start = time.perf_counter()
+        for _ in range(calls):
+            command()
+        elapsed = time.perf_counter() - start
+        print(f"{name:<24}{calls/elapsed:>14,.0f}{elapsed/calls*1e6:>10.3f}")
+
+    stop_dearpygui()
+
+add_data("data", [1, 2, 3])
+
+with window("Benchmark"):
+    add_input_float("float")
+
+set_start_callback(run_benchmarks)
+start_dearpygui()
@@ -0,0 +1,64 @@
+from dearpygui.core import *
+from dearpygui.simple import *
+from array import array
+import time
+import sys
+
+########################################################################################################################
+# Converter Benchmark
+#
+#   Times the python -> c++ conversions behind bulk commands for 10k and 1M
+#   element inputs given as lists, tuples and typed buffers.
+#
+#   usage: python benchmark_converters.py [repeats]
+########################################################################################################################
+
+repeats = int(sys.argv[1]) if len(sys.argv) > 1 else 5
+
+def timed(command, *args):
+    start = time.perf_counter()
+    for _ in range(repeats):
+        command(*args)
+    return (time.perf_counter() - start) / repeats * 1e3
+
+def run_benchmarks(sender, data):
+
+    print(f"{'conversion':<34}{'10k (ms)':>12}{'1M (ms)':>12}")
+
+    inputs = {}
+    for count in (10_000, 1_000_000):
+        values = [float(i) for i in range(count)]
+        inputs[count] = {
+            "floats (list)":       values,
+            "floats (tuple)":      tuple(values),
+            "floats (array f)":    array("f", values),
+            "floats (array d)":    array("d", values),
+            "points (list)":       [[v, v] for v in values],
+            "points (buffer)":     memoryview(array("f", values * 2)).cast("B").cast("f", (count, 2)),
+            "strings (table rows)": [[str(i), str(i)] for i in range(count // 10)],
+        }
+
+    cases = [
+        ("floats (list)",        lambda v: add_line_series("plot", "series", v, v)),
+        ("floats (tuple)",       lambda v: add_line_series("plot", "series", v, v)),
+        ("floats (array f)",     lambda v: add_line_series("plot", "series", v, v)),
+        ("floats (array d)",     lambda v: add_line_series("plot", "series", v, v)),
+        ("points (list)",        lambda v: draw_polyline("drawing", v, [255, 255, 255, 255], tag="line")),
+        ("points (buffer)",      lambda v: draw_polyline("drawing", v, [255, 255, 255, 255], tag="line")),
+        ("strings (table rows)", lambda v: set_table_data("table", v)),
+    ]
+
+    for name, command in cases:
+        small = timed(command, inputs[10_000][name])
+        large = timed(command, inputs[1_000_000][name])
+        print(f"{name:<34}{small:>12.3f}{large:>12.3f}")
+
+    stop_dearpygui()
+
+with window("Benchmark"):
+    add_plot("plot")
+    add_drawing("drawing")
+    add_table("table", ["a", "b"])
+
+set_start_callback(run_benchmarks)
+start_dearpygui()